@@ -1,6 +1,7 @@
 option(PROJECT_WARNINGS_AS_ERRORS "Treat warnings as errors" OFF)
 option(USE_ASAN "Use Address Sanitizer" OFF)
 option(USE_MSAN "Use Memory Sanitizer" OFF)
+option(ENABLE_PROFILER "Compile the frame profiler, its F4 overlay and --trace into the game" OFF)
 option(CMAKE_COLOR_DIAGNOSTICS "Enable color diagnostics" ON)
 option(BUILD_SHARED_LIBS "Build SFML as shared library" FALSE)
 
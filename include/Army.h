@@ -2,16 +2,43 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <ranges>
 
 #include "Unit.h"
 #include "Patapon.h"
 #include "Enemy.h"
 #include "GameStats.h"
+#include "EventLog.h"
+#include "TileIndex.h"
 
+// Soldiers are stored as parallel arrays (structure of arrays) so the combat
+// loops run over contiguous ints instead of chasing Patapon pointers. The
+// living count, the living defense, the reach and the damage each distance
+// receives are kept up to date whenever a soldier falls or gets back up, so
+// the per-turn queries never walk the whole army.
 class Army {
 public:
+    class PataponView {
+    public:
+        PataponView(const Army& army, std::size_t index) : m_army(&army), m_index(index) {}
+
+        [[nodiscard]] const std::string& getName() const { return m_army->m_names[m_index]; }
+        [[nodiscard]] int getHP() const { return m_army->m_hp[m_index]; }
+        [[nodiscard]] int getMaxHP() const { return m_army->m_maxHp[m_index]; }
+        [[nodiscard]] int getATK() const { return m_army->m_atk[m_index]; }
+        [[nodiscard]] int getDEF() const { return m_army->m_def[m_index]; }
+        [[nodiscard]] int getRange() const { return m_army->m_range[m_index]; }
+        [[nodiscard]] PataponType getType() const { return m_army->m_type[m_index]; }
+        [[nodiscard]] int dealDamage() const { return m_army->m_damage[m_index]; }
+        [[nodiscard]] bool isAlive() const { return getHP() > 0; }
+
+    private:
+        const Army* m_army;
+        std::size_t m_index;
+    };
+
     explicit Army(const std::vector<std::unique_ptr<Patapon>>& soldiers, int position = 0);
-    Army(const Army& other);
+    Army(const Army& other) = default;
     Army& operator=(Army other);
     ~Army() = default;
 
@@ -19,22 +46,46 @@ public:
 
     void moveForward(int steps = 1);
     void moveBackward(int steps);
-    void attackEnemies(std::vector<std::unique_ptr<Enemy>>& enemies, std::vector<std::string>& log, GameStats& stats) const;
-    void receiveEnemyAttack(int dmg, const std::string& enemyName, std::vector<std::string>& log, GameStats& stats);
-    [[nodiscard]] bool hasLivingSoldiers() const {
-        for (const auto& p : m_soldiers) {
-            if (p->isAlive()) return true;
-        }
-        return false;
+    void attackEnemies(const TileIndex& tiles, EventLog& events, GameStats& stats);
+    void receiveEnemyAttack(int dmg, const Enemy& attacker, EventLog& events, GameStats& stats);
+    [[nodiscard]] bool hasLivingSoldiers() const { return m_livingCount > 0; }
+    [[nodiscard]] int getLivingCount() const { return m_livingCount; }
+    [[nodiscard]] int getLivingDefense() const { return m_livingDefense; }
+    // -1 when nobody is left standing.
+    [[nodiscard]] int getMaxLivingRange() const { return m_maxLivingRange; }
+    // Summed damage of the living soldiers that reach an enemy `distance` tiles ahead.
+    [[nodiscard]] int getDamageAt(int distance) const {
+        return distance >= 0 && distance <= m_maxLivingRange ? m_damageWithin[static_cast<std::size_t>(distance)] : 0;
     }
     [[nodiscard]] int getPosition() const { return m_position; }
-    [[nodiscard]] const std::vector<std::unique_ptr<Patapon>>& getSoldiers() const { return m_soldiers; }
-
-
+    [[nodiscard]] std::size_t getSoldierCount() const { return m_hp.size(); }
+    [[nodiscard]] PataponView getSoldier(std::size_t index) const { return {*this, index}; }
+    [[nodiscard]] auto getSoldiers() const {
+        return std::views::iota(std::size_t{0}, m_hp.size())
+             | std::views::transform([this](std::size_t i) { return PataponView(*this, i); });
+    }
 
 private:
-    std::vector<std::unique_ptr<Patapon>> m_soldiers;
+    std::vector<std::string> m_names;
+    std::vector<int> m_hp;
+    std::vector<int> m_maxHp;
+    std::vector<int> m_atk;
+    std::vector<int> m_damage;
+    std::vector<int> m_def;
+    std::vector<int> m_range;
+    std::vector<PataponType> m_type;
     int m_position;
 
+    int m_livingCount = 0;
+    int m_livingDefense = 0;
+    int m_maxLivingRange = -1;
+    std::size_t m_front = 0;
+    std::vector<int> m_livingByRange;
+    std::vector<int> m_damageWithin;
+
     [[nodiscard]] int averageDefense() const;
+    [[nodiscard]] int firstLivingSoldier() const;
+    void applyDamage(std::size_t index, int dmg);
+    void addLiving(std::size_t index);
+    void removeLiving(std::size_t index);
 };
@@ -0,0 +1,68 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ThreadPool.h"
+
+struct AssetTiming {
+    std::string path;
+    std::chrono::microseconds decode{0};
+    std::chrono::microseconds upload{0};
+};
+
+// Loads the window's assets without blocking it. Files are read and decoded
+// on a worker pool as soon as they are added; images bound for a texture are
+// uploaded by poll(), which must run on the thread that owns the GL context.
+// Targets must stay untouched by the caller until poll() reports completion.
+class AssetLoader {
+public:
+    // Decoding is mostly disk-bound past a handful of threads.
+    static constexpr std::size_t MAX_THREADS = 4;
+
+    explicit AssetLoader(std::size_t threads = std::thread::hardware_concurrency());
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    void addTexture(const std::string& path, sf::Texture& target);
+    void addImage(const std::string& path, sf::Image& target, bool required = true);
+    void addSound(const std::string& path, sf::SoundBuffer& target);
+    // The first path that opens wins.
+    void addFont(const std::vector<std::string>& paths, sf::Font& target);
+
+    // Uploads whatever finished decoding. Returns true once every asset is in
+    // place; if a required one failed, throws its error instead.
+    bool poll();
+
+    [[nodiscard]] float getProgress() const;
+    [[nodiscard]] std::vector<AssetTiming> getTimings() const;
+    [[nodiscard]] std::chrono::microseconds getElapsed() const;
+
+private:
+    struct Entry {
+        AssetTiming timing;
+        sf::Texture* texture = nullptr;
+        sf::Image image;
+        bool required = true;
+        bool done = false;
+        std::exception_ptr error;
+        std::atomic<bool> decoded{false};
+    };
+
+    // Declared first so the pool, which still runs queued decodes when it is
+    // destroyed, goes away before the entries they write to.
+    std::vector<std::unique_ptr<Entry>> m_entries;
+    ThreadPool m_pool;
+    std::size_t m_finished = 0;
+    std::chrono::steady_clock::time_point m_started;
+    std::chrono::steady_clock::time_point m_completed;
+
+    template<typename Decode>
+    void add(const std::string& path, sf::Texture* texture, bool required, Decode decode);
+};
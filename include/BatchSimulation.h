@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+#include <iostream>
+#include <memory>
+
+#include "Army.h"
+#include "DrumPolicy.h"
+#include "Scenario.h"
+#include "Simulation.h"
+#include "ThreadPool.h"
+
+// Aligned to a cache line so the per-worker accumulators of a batch never
+// share one.
+class alignas(64) BatchStats {
+public:
+    void record(const SimulationResult& result);
+    void merge(const BatchStats& other);
+
+    [[nodiscard]] long long getGames() const { return m_games; }
+    [[nodiscard]] long long getWins() const { return m_wins; }
+    [[nodiscard]] long long getLosses() const { return m_losses; }
+    [[nodiscard]] long long getTurns() const { return m_turns; }
+    [[nodiscard]] double getWinRate() const;
+    [[nodiscard]] double getAverageTurns() const;
+    [[nodiscard]] double getAverageTurnsToWin() const;
+    [[nodiscard]] double getAverageDamageDealt() const;
+    [[nodiscard]] double getAverageDamageTaken() const;
+
+    friend std::ostream& operator<<(std::ostream& os, const BatchStats& stats);
+
+private:
+    long long m_games = 0;
+    long long m_wins = 0;
+    long long m_losses = 0;
+    long long m_turns = 0;
+    long long m_turnsToWin = 0;
+    long long m_damageDealt = 0;
+    long long m_damageTaken = 0;
+};
+
+class BatchSimulation {
+public:
+    static constexpr long long GAMES_PER_TASK = 256;
+
+    BatchSimulation(const Army& army, const DrumPolicy& policy, Scenario scenario = Scenario(),
+                    int maxTurns = Simulation::DEFAULT_MAX_TURNS);
+
+    [[nodiscard]] BatchStats run(long long games, std::uint64_t baseSeed, ThreadPool& pool) const;
+    [[nodiscard]] BatchStats runRange(long long first, long long last, std::uint64_t baseSeed) const;
+
+private:
+    Army m_army;
+    Scenario m_scenario;
+    std::unique_ptr<DrumPolicy> m_policy;
+    Simulation m_simulation;
+};
@@ -14,6 +14,7 @@ public:
     [[nodiscard]] std::string getDeathMessage() const override;
 
     [[nodiscard]] int dealDamage() const override;
+    [[nodiscard]] int getBonusDamage() const;
 
     [[nodiscard]] bool isCharging() const;
     void startCharge();
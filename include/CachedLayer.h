@@ -0,0 +1,23 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <functional>
+
+// Static scenery baked into a render texture. The bake callback only runs when
+// the layer was invalidated or the target's size or view changed; every other
+// frame the layer costs a single textured quad.
+class CachedLayer {
+public:
+    using Bake = std::function<void(sf::RenderTarget&)>;
+
+    void invalidate() { m_dirty = true; }
+    void draw(sf::RenderTarget& target, const Bake& bake);
+
+    [[nodiscard]] unsigned getBakeCount() const { return m_bakeCount; }
+
+private:
+    sf::RenderTexture m_texture;
+    sf::Vector2f m_bakedCenter;
+    sf::Vector2f m_bakedSize;
+    bool m_dirty = true;
+    unsigned m_bakeCount = 0;
+};
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+enum class Drum : std::uint8_t { PATA, PON };
+
+enum class Chant : std::uint8_t { NONE, MOVE, ATTACK, RETREAT };
+
+// The chants the army understands, compiled into an Aho-Corasick automaton
+// over the two drums. Following one beat is a single table lookup, and the
+// state reached tells which chant (if any) was just completed. When several
+// chants end on the same beat, the one declared first wins.
+class ChantBook {
+public:
+    static constexpr std::size_t MAX_CHANT_LENGTH = 16;
+
+    struct Entry {
+        Chant chant;
+        std::vector<Drum> drums;
+    };
+
+    explicit ChantBook(std::vector<Entry> entries);
+
+    static std::shared_ptr<const ChantBook> getDefault();
+
+    [[nodiscard]] int advance(int state, Drum drum) const {
+        return m_next[static_cast<std::size_t>(state) * 2 + static_cast<std::size_t>(drum)];
+    }
+    [[nodiscard]] Chant getMatch(int state) const { return m_match[static_cast<std::size_t>(state)]; }
+    [[nodiscard]] int getStateCount() const { return static_cast<int>(m_match.size()); }
+    [[nodiscard]] std::size_t getMaxLength() const { return m_maxLength; }
+    [[nodiscard]] const std::vector<Entry>& getEntries() const { return m_entries; }
+    [[nodiscard]] const std::vector<Drum>* find(Chant chant) const;
+
+private:
+    std::vector<Entry> m_entries;
+    std::vector<int> m_next;
+    std::vector<Chant> m_match;
+    std::size_t m_maxLength;
+
+    void compile();
+};
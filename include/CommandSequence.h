@@ -1,24 +1,28 @@
 #pragma once
-#include <vector>
-#include <string>
+#include <cstdint>
+#include <memory>
 
+#include "ChantBook.h"
 
+// The drums played since the last completed chant, kept as bits in a fixed
+// shift register next to the chant automaton state. Pushing a drum never
+// allocates.
 class CommandSequence {
 public:
     CommandSequence();
-    explicit CommandSequence(const std::vector<std::string>& initialCommands);
+    explicit CommandSequence(std::shared_ptr<const ChantBook> chants);
 
-    void push(const std::string &cmd);
-    [[nodiscard]] bool matchesMove() const;
-    [[nodiscard]] bool matchesAttack() const;
-    [[nodiscard]] bool matchesRetreat() const;
+    void push(Drum drum);
+    [[nodiscard]] Chant match() const { return m_chants->getMatch(m_state); }
     void clear();
-    [[nodiscard]] const std::vector<std::string>& getCommands() const;
-
 
+    [[nodiscard]] std::size_t size() const { return m_size; }
+    [[nodiscard]] Drum operator[](std::size_t index) const;
+    [[nodiscard]] const ChantBook& getChants() const { return *m_chants; }
 
 private:
-    std::vector<std::string> m_seq;
-    static constexpr std::size_t m_maxHistory = 4;
-    [[nodiscard]] bool endsWithPattern(const std::vector<std::string> &pattern) const;
+    std::shared_ptr<const ChantBook> m_chants;
+    int m_state;
+    std::uint32_t m_history;
+    std::size_t m_size;
 };
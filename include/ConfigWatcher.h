@@ -0,0 +1,70 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "GameConfig.h"
+
+// Keeps a GameConfig in step with its file while the game runs. A background
+// thread waits for the file to change (inotify on its directory on Linux, so
+// editors that save by renaming are seen too; a modification time poll
+// elsewhere), re-parses it against the current config and swaps the result
+// in. A file that fails to parse, or lacks a soldier the menu offers, keeps
+// the previous config and records why. Reloads read the file into memory
+// rather than mapping it: an editor may truncate it mid-save, and touching a
+// mapped page past the new end raises SIGBUS.
+class ConfigWatcher {
+public:
+    static constexpr std::chrono::milliseconds DEFAULT_POLL_INTERVAL{250};
+
+    explicit ConfigWatcher(std::string filename, std::chrono::milliseconds pollInterval = DEFAULT_POLL_INTERVAL);
+    ~ConfigWatcher();
+
+    ConfigWatcher(const ConfigWatcher&) = delete;
+    ConfigWatcher& operator=(const ConfigWatcher&) = delete;
+
+    void stop();
+
+    [[nodiscard]] std::shared_ptr<const GameConfig> getConfig() const;
+    [[nodiscard]] std::uint64_t getReloads() const { return m_reloads.load(std::memory_order_relaxed); }
+    [[nodiscard]] std::uint64_t getFailures() const { return m_failures.load(std::memory_order_relaxed); }
+    // Why the last reload failed, or empty when it succeeded.
+    [[nodiscard]] std::string getLastError() const;
+    [[nodiscard]] bool usesInotify() const { return m_inotify >= 0; }
+
+private:
+    struct Stamp {
+        std::filesystem::file_time_type modified{};
+        std::uintmax_t size = 0;
+
+        bool operator==(const Stamp& other) const = default;
+    };
+
+    std::string m_filename;
+    std::string m_name;
+    std::chrono::milliseconds m_pollInterval;
+    // Guards m_config and m_lastError.
+    mutable std::mutex m_mutex;
+    std::shared_ptr<const GameConfig> m_config;
+    std::string m_lastError;
+    std::atomic<std::uint64_t> m_reloads{0};
+    std::atomic<std::uint64_t> m_failures{0};
+    Stamp m_stamp;
+    int m_inotify = -1;
+    std::atomic<bool> m_stopping{false};
+    std::thread m_watcher;
+
+    void watchLoop();
+    [[nodiscard]] bool waitForChange();
+    [[nodiscard]] bool waitForEvent();
+    [[nodiscard]] Stamp readStamp() const;
+    [[nodiscard]] std::string readFile() const;
+    void reload();
+    void recordFailure(const std::string& error);
+    static void validate(const GameConfig& config);
+};
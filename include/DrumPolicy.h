@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "ChantBook.h"
+#include "Random.h"
+
+class DrumPolicy {
+public:
+    virtual ~DrumPolicy() = default;
+
+    [[nodiscard]] virtual std::unique_ptr<DrumPolicy> clone() const = 0;
+    virtual void reset(std::uint64_t seed) = 0;
+    virtual Drum nextDrum() = 0;
+    // The next drums.size() drums, with one virtual call for the whole run.
+    virtual void fill(std::span<Drum> drums);
+};
+
+class ScriptedPolicy : public DrumPolicy {
+public:
+    explicit ScriptedPolicy(std::vector<Drum> script);
+
+    [[nodiscard]] std::unique_ptr<DrumPolicy> clone() const override;
+    void reset(std::uint64_t seed) override;
+    Drum nextDrum() override;
+    void fill(std::span<Drum> drums) override;
+
+private:
+    std::vector<Drum> m_script;
+    std::size_t m_next;
+};
+
+// Drums whole chants from the chant book picked uniformly at random, so every
+// game of a batch explores a different order of moves, attacks and retreats.
+class RandomChantPolicy : public DrumPolicy {
+public:
+    explicit RandomChantPolicy(std::shared_ptr<const ChantBook> chants = ChantBook::getDefault());
+
+    [[nodiscard]] std::unique_ptr<DrumPolicy> clone() const override;
+    void reset(std::uint64_t seed) override;
+    Drum nextDrum() override;
+    void fill(std::span<Drum> drums) override;
+
+private:
+    std::shared_ptr<const ChantBook> m_chants;
+    Random m_random;
+    std::size_t m_chant;
+    std::size_t m_beat;
+};
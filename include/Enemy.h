@@ -3,9 +3,13 @@
 #include "GameException.h"
 #include <memory>
 
+class TileIndex;
+
 class Enemy : public Unit {
 public:
     Enemy(std::string name, int hp, int atk, int pos);
+    Enemy(const Enemy& other);
+    Enemy& operator=(const Enemy& other) = delete;
     ~Enemy() override = default;
 
 
@@ -23,4 +27,13 @@ public:
 protected:
 
     int m_pos;
+
+private:
+    friend class TileIndex;
+
+    // Set while the enemy is in a TileIndex, which setPos keeps informed.
+    // Copies start outside any index.
+    TileIndex* m_tiles = nullptr;
+
+    void setTileIndex(TileIndex* tiles) { m_tiles = tiles; }
 };
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// Index plus generation. The generation of an index is bumped every time it
+// is released, so an id held past its entity's death never matches the
+// entity that later reuses the same index.
+struct EntityId {
+    static constexpr std::uint32_t INVALID_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t index = INVALID_INDEX;
+    std::uint32_t generation = 0;
+
+    [[nodiscard]] bool isValid() const { return index != INVALID_INDEX; }
+    bool operator==(const EntityId& other) const = default;
+};
+
+class EntityIdAllocator {
+public:
+    [[nodiscard]] EntityId allocate();
+    void release(EntityId id);
+
+    [[nodiscard]] bool isAlive(EntityId id) const {
+        return id.index < m_generations.size() && m_generations[id.index] == id.generation && m_alive[id.index];
+    }
+    [[nodiscard]] std::size_t getAliveCount() const { return m_generations.size() - m_free.size(); }
+
+private:
+    std::vector<std::uint32_t> m_generations;
+    std::vector<bool> m_alive;
+    std::vector<std::uint32_t> m_free;
+};
@@ -0,0 +1,51 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "EventLog.h"
+#include "SpscRing.h"
+
+// Appends combat events to a binary file from a background thread. The game
+// thread hands events over through a single-producer single-consumer ring.
+// When the ring is full, push() waits for the writer to catch up, so the file
+// holds every event. A producer that must never stall, such as a frame loop,
+// opts into Overflow::DROP instead, and then has to treat getDropped() > 0 as
+// a journal that is incomplete.
+//
+// File layout: the four bytes "PJRN", then one 17-byte record per event:
+// turn, kind (one byte), actor, target, amount, as host-order int32.
+class EventJournal {
+public:
+    static constexpr char MAGIC[4] = {'P', 'J', 'R', 'N'};
+    static constexpr std::size_t CAPACITY = 4096;
+
+    enum class Overflow { WAIT, DROP };
+
+    explicit EventJournal(const std::string& filename, Overflow overflow = Overflow::WAIT);
+    ~EventJournal();
+
+    EventJournal(const EventJournal&) = delete;
+    EventJournal& operator=(const EventJournal&) = delete;
+
+    bool push(const CombatEvent& event) noexcept;
+    void close();
+
+    [[nodiscard]] std::uint64_t getWritten() const { return m_written.load(std::memory_order_relaxed); }
+    [[nodiscard]] std::uint64_t getDropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+    std::ofstream m_file;
+    Overflow m_overflow;
+    SpscRing<CombatEvent, CAPACITY> m_ring;
+    std::atomic<std::uint64_t> m_written{0};
+    std::atomic<std::uint64_t> m_dropped{0};
+    std::atomic<bool> m_stopping{false};
+    std::thread m_writer;
+
+    void writerLoop();
+    bool drain();
+    void write(const CombatEvent& event);
+};
@@ -0,0 +1,79 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+class Army;
+class Enemy;
+class EventJournal;
+class Scenario;
+
+enum class CombatEventKind : std::uint8_t {
+    BEAST_APPEARED,
+    BOSS_APPEARED,
+    MOVE_BLOCKED,
+    FIELD_CLEARED,
+    ARMY_ADVANCED,
+    RETREAT_BLOCKED,
+    ARMY_RETREATED,
+    ARMY_ATTACKS,
+    ENEMY_HIT,
+    ENEMY_DEFEATED,
+    COUNTERATTACK,
+    SOLDIER_HIT,
+    SOLDIER_DEFEATED,
+    ENEMY_FELL,
+    BOSS_MISSED,
+    BOSS_GATHERING,
+    BOSS_PREPARING
+};
+
+// Soldiers are referenced by their index in the army, enemies by the scenario
+// prototype they were cloned from.
+struct CombatEvent {
+    static constexpr std::int32_t NONE = -1;
+    static constexpr std::int32_t BEAST = 0;
+    static constexpr std::int32_t BOSS = 1;
+
+    std::int32_t turn;
+    CombatEventKind kind;
+    std::int32_t actor;
+    std::int32_t target;
+    std::int32_t amount;
+
+    static std::int32_t enemy(const Enemy& enemy);
+
+    bool operator==(const CombatEvent& other) const = default;
+};
+
+static_assert(std::is_trivially_copyable_v<CombatEvent>);
+
+// The events of the current turn, kept in a fixed ring so recording a hit
+// never allocates. Text is only built by describe(), when someone reads it.
+class EventLog {
+public:
+    static constexpr std::size_t CAPACITY = 64;
+
+    void beginTurn(int turn);
+    void push(CombatEventKind kind, std::int32_t actor = CombatEvent::NONE,
+              std::int32_t target = CombatEvent::NONE, std::int32_t amount = 0);
+
+    [[nodiscard]] std::size_t size() const { return m_size; }
+    [[nodiscard]] bool empty() const { return m_size == 0; }
+    [[nodiscard]] const CombatEvent& operator[](std::size_t index) const {
+        return m_events[(m_start + index) % CAPACITY];
+    }
+    [[nodiscard]] const CombatEvent& back() const { return (*this)[m_size - 1]; }
+
+    void setJournal(EventJournal* journal) { m_journal = journal; }
+
+    [[nodiscard]] static std::string describe(const CombatEvent& event, const Army& army, const Scenario& scenario);
+
+private:
+    std::array<CombatEvent, CAPACITY> m_events{};
+    std::size_t m_start = 0;
+    std::size_t m_size = 0;
+    std::int32_t m_turn = 0;
+    EventJournal* m_journal = nullptr;
+};
@@ -0,0 +1,98 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Wall-clock timings of named sections of the frame on one thread. Keeps the
+// last HISTORY frame times and a smoothed time per section for the on-screen
+// graph, and can stream every section to a Chrome trace-event file that
+// chrome://tracing or Perfetto open directly.
+//
+// Section names must be string literals: they are kept by pointer and written
+// to the trace unescaped.
+class FrameProfiler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t HISTORY = 240;
+
+    struct Section {
+        const char* name;
+        int depth;
+        float lastMs;
+        float averageMs;
+    };
+
+    FrameProfiler();
+    ~FrameProfiler();
+
+    FrameProfiler(const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+    void beginFrame();
+    void endFrame();
+
+    void startTrace(const std::string& filename);
+    void stopTrace();
+
+    [[nodiscard]] const std::array<float, HISTORY>& getFrameHistory() const { return m_frameMs; }
+    // Index in getFrameHistory() of the oldest frame.
+    [[nodiscard]] std::size_t getHistoryStart() const { return m_historyNext; }
+    [[nodiscard]] const std::vector<Section>& getSections() const { return m_sections; }
+
+private:
+    friend class ProfileScope;
+
+    static constexpr float SMOOTHING = 0.1f;
+
+    Clock::time_point m_origin;
+    Clock::time_point m_frameStart;
+    int m_depth = 0;
+
+    std::array<float, HISTORY> m_frameMs{};
+    std::size_t m_historyNext = 0;
+    std::vector<Section> m_sections;
+    std::vector<float> m_frameSectionMs;
+
+    std::ofstream m_trace;
+    bool m_firstTraceEvent = true;
+
+    // Sections are listed in the order they first open, parents before children.
+    std::size_t open(const char* name);
+    void record(std::size_t section, Clock::time_point start, Clock::time_point end);
+    void writeTraceEvent(const char* name, Clock::time_point start, Clock::time_point end);
+};
+
+// Times from construction to destruction, or to each next(), which closes the
+// running section and opens a sibling, for long functions made of stages.
+class ProfileScope {
+public:
+    ProfileScope(FrameProfiler& profiler, const char* name);
+    ~ProfileScope();
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    void next(const char* name);
+
+private:
+    FrameProfiler& m_profiler;
+    std::size_t m_section;
+    FrameProfiler::Clock::time_point m_start;
+};
+
+// Without ENABLE_PROFILER these expand to nothing, not even the clock reads.
+#ifdef ENABLE_PROFILER
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+#define PROFILE_SCOPE(profiler, name) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)((profiler), (name))
+#define PROFILE_SECTION(profiler, section, name) ProfileScope section((profiler), (name))
+#define PROFILE_NEXT(section, name) (section).next(name)
+#else
+#define PROFILE_SCOPE(profiler, name)
+#define PROFILE_SECTION(profiler, section, name)
+#define PROFILE_NEXT(section, name)
+#endif
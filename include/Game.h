@@ -2,21 +2,29 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <cstdint>
 
 #include "Army.h"
+#include "Boss.h"
 #include "Enemy.h"
 #include "CommandSequence.h"
+#include "EntityId.h"
+#include "EventLog.h"
 #include "GameStats.h"
 #include "GameConstants.h"
+#include "Random.h"
+#include "Scenario.h"
+#include "TileIndex.h"
 
 class Game {
 public:
-    Game(const Army& army, std::vector<std::unique_ptr<Enemy>> enemies);
+    Game(const Army& army, std::vector<std::unique_ptr<Enemy>> enemies, std::uint64_t seed, Scenario scenario = Scenario());
+    Game(const Game&) = delete;
+    Game& operator=(const Game&) = delete;
 
-    void submitCommand(const std::string& input) {
+    void submitCommand(Drum drum) {
         if (m_won || m_lost || m_bossEventActive) return;
-        if (input != "pa" && input != "po") return;
-        m_commands.push(input);
+        m_commands.push(drum);
         processTurn();
     }
     void update();
@@ -28,18 +36,31 @@ public:
     [[nodiscard]] const Army& getArmy() const { return m_army; }
     [[nodiscard]] const std::vector<std::unique_ptr<Enemy>>& getEnemies() const { return m_enemies; }
     [[nodiscard]] const CommandSequence& getCommands() const { return m_commands; }
-    [[nodiscard]] const std::vector<std::string>& getLog() const { return m_log; }
+    [[nodiscard]] const EventLog& getEvents() const { return m_events; }
+    [[nodiscard]] std::string describe(const CombatEvent& event) const {
+        return EventLog::describe(event, m_army, m_scenario);
+    }
+    void setJournal(EventJournal* journal) { m_events.setJournal(journal); }
     [[nodiscard]] const GameStats& getStats() const { return m_stats; }
     [[nodiscard]] int getGoal() const { return m_goal; }
+    [[nodiscard]] int getMapSize() const { return m_tiles.getTileCount(); }
+    [[nodiscard]] const Scenario& getScenario() const { return m_scenario; }
+    [[nodiscard]] const EntityIdAllocator& getEntityIds() const { return m_entityIds; }
+    [[nodiscard]] const TileIndex& getTiles() const { return m_tiles; }
 
 
 
 private:
     Army m_army;
     std::vector<std::unique_ptr<Enemy>> m_enemies;
+    std::vector<Boss*> m_bosses;
     CommandSequence m_commands;
-    std::vector<std::string> m_log;
+    EventLog m_events;
     GameStats m_stats;
+    Random m_random;
+    Scenario m_scenario;
+    TileIndex m_tiles;
+    EntityIdAllocator m_entityIds;
     bool m_won;
     bool m_lost;
     int m_turns;
@@ -50,9 +71,11 @@ private:
     void handleAttack();
     void cleanupDeadEnemies();
     void enemiesAttack();
+    void bossAttack(Boss& boss, int range);
     void enemiesAdvance();
     void spawnBeast();
     void spawnBoss();
+    void addEnemy(std::unique_ptr<Enemy> enemy);
 
 public:
     [[nodiscard]] bool isBossEventActive() const { return m_bossEventActive; }
@@ -3,11 +3,25 @@
 #include <SFML/Audio.hpp>
 #include <memory>
 #include <vector>
-#include <map>
-#include "Game.h"
+#include <utility>
+#include <string>
+#include <string_view>
+#include <array>
+#include "GameConfig.h"
+#include "ConfigWatcher.h"
+#include "SimulationThread.h"
 #include "AnimatedPosition.h"
+#include "AssetLoader.h"
+#include "FrameProfiler.h"
+#include "LatencyHistogram.h"
+#include "CachedLayer.h"
+#include "ShapeBatch.h"
+#include "SlotMap.h"
+#include "TextCache.h"
+#include "VoicePool.h"
 
 enum class GameState {
+    LOADING,
     MENU,
     GAME
 };
@@ -71,17 +85,43 @@ private:
 
 class GameApplication {
 public:
-    GameApplication();
+    // Stages of a drum press: until the simulation picks it up, the turn it
+    // triggers, until a frame showing the result is displayed, and end to end.
+    static constexpr std::array<std::string_view, 4> LATENCY_STAGES = {"queue", "simulate", "present", "total"};
+
+    explicit GameApplication(bool prewarmGlyphs = true);
     void run();
 
+    [[nodiscard]] sf::Time getWorstFrame() const { return m_worstFrame; }
+    [[nodiscard]] const std::vector<AssetTiming>& getAssetTimings() const { return m_assetTimings; }
+    [[nodiscard]] std::chrono::microseconds getLoadTime() const { return m_loadTime; }
+#ifdef ENABLE_PROFILER
+    void startTrace(const std::string& filename) { m_profiler.startTrace(filename); }
+#endif
+    [[nodiscard]] const std::array<LatencyHistogram, LATENCY_STAGES.size()>& getInputLatency() const { return m_inputLatency; }
+    [[nodiscard]] const VoicePool* getDrumVoices(Drum drum) const {
+        return (drum == Drum::PATA ? m_pataVoices : m_ponVoices).get();
+    }
+
 private:
     void processEvents();
     void update(float dt);
     void render();
+    void recordPresented();
+    void renderLatencyOverlay();
+#ifdef ENABLE_PROFILER
+    void renderProfiler();
+#endif
+    void finishLoading();
+    void renderLoading();
     void renderMenu();
     void renderStats();
     void renderWinScreen();
     void renderLoseScreen();
+    void addGoalTotem(ShapeBatch& batch) const;
+    void updateCamera(float dt, bool snap);
+    [[nodiscard]] std::pair<int, int> getVisibleTiles() const;
+    void bakeCommandPanel(sf::RenderTarget& target);
 
     const sf::Texture& getUnitTexture(UnitType type) const;
     
@@ -95,7 +135,10 @@ private:
 
     sf::RenderWindow m_window;
     sf::Font m_font;
-
+    sf::Image m_icon;
+    std::vector<AssetTiming> m_assetTimings;
+    std::chrono::microseconds m_loadTime{0};
+    bool m_prewarmGlyphs;
 
     sf::Texture m_pataTexture;
     sf::Texture m_ponTexture;
@@ -103,7 +146,7 @@ private:
     sf::Texture m_tateponTexture;
     sf::Texture m_yumiponTexture;
     
-    std::vector<sf::Texture*> m_pataponIcons;
+    std::vector<const sf::Texture*> m_pataponIcons;
 
 
     sf::Sprite m_pataSprite;
@@ -111,8 +154,8 @@ private:
 
     sf::SoundBuffer m_pataBuffer;
     sf::SoundBuffer m_ponBuffer;
-    sf::Sound m_pataSound;
-    sf::Sound m_ponSound;
+    std::unique_ptr<VoicePool> m_pataVoices;
+    std::unique_ptr<VoicePool> m_ponVoices;
 
     float m_pataAnimTimer = 0.0f;
     bool m_pataAnimActive = false;
@@ -123,15 +166,53 @@ private:
 
     ArrowAnimation m_arrowAnim;
 
+    ShapeBatch m_backgroundBatch;
+    ShapeBatch m_unitBatch;
+    ShapeBatch m_hudBatch;
+    ShapeBatch m_foregroundBatch;
+
+    CachedLayer m_commandPanelLayer;
+
+    TextCache m_texts;
+    std::string m_sequenceText;
 
-    std::unique_ptr<Game> m_game;
+    struct VisibleEnemy {
+        const EnemySnapshot* enemy;
+        const AnimatedPosition* tween;
+    };
+
+    sf::View m_camera;
+    std::vector<VisibleEnemy> m_visibleEnemies;
+    sf::Time m_worstFrame;
+
+    std::array<LatencyHistogram, LATENCY_STAGES.size()> m_inputLatency;
+    std::vector<InputTrace> m_pendingTraces;
+    std::uint64_t m_renderedTick = 0;
+    bool m_showLatency = false;
+
+#ifdef ENABLE_PROFILER
+    FrameProfiler m_profiler;
+    ShapeBatch m_profilerBatch;
+    std::string m_profilerText;
+    bool m_showProfiler = false;
+#endif
+
+
+    std::unique_ptr<ConfigWatcher> m_configWatcher;
+    // The config the current game started with; a newer one applies from the next game.
+    std::shared_ptr<const GameConfig> m_config;
+    std::unique_ptr<SimulationThread> m_simulation;
     AnimatedPosition m_armyPos;
-    std::map<const Enemy*, AnimatedPosition> m_enemyPositions;
+    SlotMap<AnimatedPosition> m_enemyPositions;
+    std::vector<std::uint64_t> m_enemySeenTick;
+    std::uint32_t m_shownAttacks = 0;
 
 
     const float m_fieldLeft = 50.0f;
 
     const float m_fieldWidth = 1100.0f;
+    const float m_tileWidth = m_fieldWidth / (GameConstants::MAP_SIZE - 1);
+    const float CAMERA_FOLLOW_RATE = 5.0f;
     const float m_unitRadius = 35.0f;
     const float m_fieldY = 600.0f - 35.0f + 10.0f;
 
@@ -145,4 +226,7 @@ private:
     GameState m_state;
     std::vector<UnitType> m_selectedUnits;
     int m_menuSelectionIndex = 0;
+
+    // Last, so it is destroyed, and its decodes joined, before their targets.
+    std::unique_ptr<AssetLoader> m_assets;
 };
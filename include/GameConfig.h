@@ -1,5 +1,7 @@
 #pragma once
+#include <array>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
 #include "Patapon.h"
@@ -7,8 +9,43 @@
 #include "Tatepon.h"
 #include "Yumipon.h"
 #include "GameException.h"
+#include "ChantBook.h"
+#include "Scenario.h"
 
+// Everything a config file describes: the soldier templates, plus a Scenario
+// built from its ENEMY, BOSS, MAP and CHANT lines. Lines a file leaves out
+// keep the Scenario defaults. The file is memory-mapped and parsed in one
+// pass. load() caches the result per path, so asking again is a lookup
+// until the file's modification time or size changes.
+// reparse() reads an edited file against an existing config and keeps every
+// section whose lines did not change, chant automaton included.
 class GameConfig {
 public:
-    static std::vector<std::unique_ptr<Patapon>> loadSoldiers(const std::string& filename);
+    static std::shared_ptr<const GameConfig> load(const std::string& filename);
+    static GameConfig parse(std::string_view text);
+    [[nodiscard]] GameConfig reparse(std::string_view text) const;
+
+    GameConfig(const GameConfig& other);
+    GameConfig& operator=(GameConfig other);
+    GameConfig(GameConfig&& other) noexcept = default;
+    ~GameConfig() = default;
+
+    friend void swap(GameConfig& first, GameConfig& second) noexcept;
+
+    [[nodiscard]] const std::vector<std::unique_ptr<Patapon>>& getSoldiers() const { return m_soldiers; }
+    [[nodiscard]] std::vector<std::unique_ptr<Patapon>> makeSoldiers() const;
+    // The first soldier of that type, or nullptr when the file has none.
+    [[nodiscard]] const Patapon* findSoldier(PataponType type) const;
+    [[nodiscard]] const Scenario& getScenario() const { return m_scenario; }
+
+private:
+    static constexpr std::size_t SECTION_COUNT = 5;
+
+    GameConfig() = default;
+    static GameConfig build(std::string_view text, const GameConfig* previous);
+
+    std::vector<std::unique_ptr<Patapon>> m_soldiers;
+    Scenario m_scenario;
+    // The lines of each section as they appeared, to tell what an edit touched.
+    std::array<std::string, SECTION_COUNT> m_sections;
 };
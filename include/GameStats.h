@@ -1,5 +1,6 @@
 #pragma once
 #include <iostream>
+#include <cstdint>
 
 class GameStats {
 public:
@@ -11,12 +12,16 @@ public:
     void addCommand();
     void addSteps(int steps);
     void addTurn();
+    void setSeed(std::uint64_t value);
 
     [[nodiscard]] int getDamageDealt() const { return damageDealt; }
     [[nodiscard]] int getDamageTaken() const { return damageTaken; }
     [[nodiscard]] int getCommandsCount() const { return commandsCount; }
     [[nodiscard]] int getStepsTaken() const { return stepsTaken; }
     [[nodiscard]] int getTurns() const { return turns; }
+    [[nodiscard]] std::uint64_t getSeed() const { return seed; }
+
+    friend std::ostream& operator<<(std::ostream& os, const GameStats& stats);
 
 private:
     int damageDealt;
@@ -24,4 +29,5 @@ private:
     int commandsCount;
     int stepsTaken;
     int turns;
+    std::uint64_t seed;
 };
@@ -0,0 +1,22 @@
+#pragma once
+#include <string>
+#include <vector>
+
+#include "ChantBook.h"
+
+// A drum script in the tastatura.txt format: whitespace separated keys,
+// A for PATA and D for PON, with '#' starting a comment line.
+class KeyScript {
+public:
+    KeyScript(std::string name, std::vector<Drum> drums);
+
+    static KeyScript loadFromFile(const std::string& filename);
+    static std::vector<KeyScript> loadAll(const std::string& path);
+
+    [[nodiscard]] const std::string& getName() const { return m_name; }
+    [[nodiscard]] const std::vector<Drum>& getDrums() const { return m_drums; }
+
+private:
+    std::string m_name;
+    std::vector<Drum> m_drums;
+};
@@ -0,0 +1,60 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Army.h"
+#include "BatchSimulation.h"
+#include "DrumPolicy.h"
+#include "Scenario.h"
+#include "Simulation.h"
+#include "ThreadPool.h"
+
+// Plays LANES independent games side by side. Every rule of Game::processTurn
+// and Game::update is evaluated on small integer arrays with per-lane masks
+// instead of branches, drums and spawn rolls are drawn ahead into bit streams,
+// and a finished lane picks up the next seed at once. The scalar Game stays
+// the reference; tests/LaneSimulationTest.cpp compares both.
+template <int LANES>
+class LaneSimulation {
+public:
+    static_assert(LANES > 0, "LaneSimulation needs at least one lane");
+
+    static constexpr long long GAMES_PER_TASK = 4096;
+
+    LaneSimulation(const Army& army, const DrumPolicy& policy, const Scenario& scenario = Scenario(),
+                   int maxTurns = Simulation::DEFAULT_MAX_TURNS);
+
+    // Results in seed order, whatever order the lanes finish them in.
+    [[nodiscard]] std::vector<SimulationResult> runGames(std::uint64_t firstSeed, long long games) const;
+    [[nodiscard]] BatchStats runRange(long long first, long long last, std::uint64_t baseSeed) const;
+    [[nodiscard]] BatchStats run(long long games, std::uint64_t baseSeed, ThreadPool& pool) const;
+
+private:
+    class Kernel;
+
+    std::unique_ptr<DrumPolicy> m_policy;
+    std::shared_ptr<const ChantBook> m_chants;
+    int m_maxTurns;
+
+    int m_soldierCount;
+    std::vector<int> m_initialHp;
+    std::vector<int> m_defense;
+    std::vector<int> m_averageDefense;
+    std::vector<int> m_soldierDamage;
+    std::vector<int> m_soldierRange;
+
+    int m_mapSize;
+    int m_goal;
+    int m_waves;
+    int m_waveSpacing;
+    int m_firstSpawn;
+    int m_bossSpawn;
+    int m_beastHp;
+    int m_beastDamage;
+    int m_bossHp;
+    int m_bossDamage;
+};
+
+extern template class LaneSimulation<8>;
+extern template class LaneSimulation<16>;
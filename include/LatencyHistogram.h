@@ -0,0 +1,38 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string_view>
+
+// Log-linear histogram of microsecond latencies in the style of HdrHistogram:
+// every power of two is split into the same number of sub-buckets, so values
+// keep about three percent precision from 1 us up to hours in a fixed table.
+class LatencyHistogram {
+public:
+    static constexpr unsigned SUB_BUCKET_BITS = 6;
+    static constexpr std::uint64_t SUB_BUCKETS = std::uint64_t{1} << SUB_BUCKET_BITS;
+    static constexpr std::size_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * (SUB_BUCKETS / 2) + SUB_BUCKETS / 2;
+
+    void record(std::chrono::microseconds value);
+    void reset();
+
+    [[nodiscard]] std::uint64_t getCount() const { return m_count; }
+    [[nodiscard]] std::chrono::microseconds getMin() const;
+    [[nodiscard]] std::chrono::microseconds getMax() const { return std::chrono::microseconds(m_max); }
+    [[nodiscard]] std::chrono::microseconds getMean() const;
+    // Upper bound of the bucket holding the given percentile, in [0, 100].
+    [[nodiscard]] std::chrono::microseconds getPercentile(double percentile) const;
+
+    void print(std::ostream& out, std::string_view label) const;
+
+private:
+    std::array<std::uint64_t, BUCKET_COUNT> m_buckets{};
+    std::uint64_t m_count = 0;
+    std::uint64_t m_total = 0;
+    std::uint64_t m_min = UINT64_MAX;
+    std::uint64_t m_max = 0;
+
+    [[nodiscard]] static std::size_t bucketOf(std::uint64_t value);
+    [[nodiscard]] static std::uint64_t upperBound(std::size_t bucket);
+};
@@ -0,0 +1,59 @@
+#pragma once
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Army.h"
+#include "DrumPolicy.h"
+#include "Patapon.h"
+#include "Scenario.h"
+#include "ThreadPool.h"
+
+class SweepRange {
+public:
+    SweepRange(std::string parameter, int min, int max, int step);
+
+    [[nodiscard]] const std::string& getParameter() const { return m_parameter; }
+    [[nodiscard]] int getMin() const { return m_min; }
+    [[nodiscard]] int getMax() const { return m_max; }
+    [[nodiscard]] int getStep() const { return m_step; }
+    [[nodiscard]] int getValueCount() const { return (m_max - m_min) / m_step + 1; }
+    [[nodiscard]] int getValue(int index) const { return m_min + index * m_step; }
+
+private:
+    std::string m_parameter;
+    int m_min;
+    int m_max;
+    int m_step;
+};
+
+// Balance sweep over soldier, beast and boss stats, read from a file such as
+// assets/sweep_config.txt. Every sampled configuration is played SEEDS times
+// and reported as one CSV row.
+class ParameterSweep {
+public:
+    static constexpr long long MAX_GRID_CONFIGURATIONS = 1000000;
+
+    static ParameterSweep loadFromFile(const std::string& filename);
+
+    [[nodiscard]] std::vector<std::vector<int>> sampleConfigurations() const;
+    void run(const std::vector<std::unique_ptr<Patapon>>& baseSoldiers, const Scenario& baseScenario,
+             const DrumPolicy& policy, ThreadPool& pool, std::ostream& csv) const;
+
+private:
+    std::vector<SweepRange> m_ranges;
+    bool m_latinHypercube = false;
+    int m_samples = 0;
+    long long m_seedsPerConfiguration = 100;
+    std::uint64_t m_baseSeed = 1;
+
+    template <typename T>
+    [[nodiscard]] std::unique_ptr<Patapon> sweptSoldier(const Patapon& base, const std::string& key,
+                                                        const std::vector<int>& values) const;
+    [[nodiscard]] Army buildArmy(const std::vector<std::unique_ptr<Patapon>>& baseSoldiers,
+                                 const std::vector<int>& values) const;
+    [[nodiscard]] Scenario buildScenario(const Scenario& baseScenario, const std::vector<int>& values) const;
+    [[nodiscard]] int lookup(const std::string& parameter, const std::vector<int>& values, int fallback) const;
+};
@@ -4,6 +4,12 @@
 #include "GameException.h"
 #include <memory>
 
+enum class PataponType {
+    SPEAR,
+    SHIELD,
+    BOW
+};
+
 class Patapon : public Unit {
 public:
     Patapon(std::string name, int max_hp, int atk, int def);
@@ -15,6 +21,7 @@ public:
     void takeDamage(int dmg) override;
 
     [[nodiscard]] virtual int getRange() const = 0;
+    [[nodiscard]] virtual PataponType getType() const = 0;
     [[nodiscard]] int getDEF() const { return m_def; }
 
 protected:
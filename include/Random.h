@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+
+// xoshiro256** seeded through splitmix64; every Game owns its own instance so
+// parallel games never share generator state.
+class Random {
+public:
+    explicit Random(std::uint64_t seed) {
+        for (auto& word : m_state) {
+            seed += 0x9E3779B97F4A7C15ULL;
+            std::uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            word = z ^ (z >> 31);
+        }
+    }
+
+    std::uint64_t next() {
+        const std::uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+        const std::uint64_t t = m_state[1] << 17;
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= t;
+        m_state[3] = rotl(m_state[3], 45);
+        return result;
+    }
+
+    int nextBelow(int bound) {
+        return static_cast<int>(((next() >> 32) * static_cast<std::uint64_t>(bound)) >> 32);
+    }
+
+private:
+    std::uint64_t m_state[4]{};
+
+    static std::uint64_t rotl(std::uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+};
@@ -0,0 +1,52 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ChantBook.h"
+#include "EntityId.h"
+#include "GameStats.h"
+
+struct SoldierSnapshot {
+    int hp;
+    int maxHp;
+};
+
+struct EnemySnapshot {
+    EntityId id;
+    int pos;
+    bool boss;
+    bool charging;
+    int chargeTurns;
+    // Living enemies on this tile when this is the first of them, otherwise 0.
+    std::size_t stack;
+};
+
+// Everything the window draws, copied out of Game once per simulation tick.
+// Enemies are limited to the tiles around the army, ordered by tile.
+struct RenderSnapshot {
+    std::uint64_t tick = 0;
+    std::chrono::steady_clock::time_point publishedAt;
+
+    int armyPosition = 0;
+    int livingSoldiers = 0;
+    int maxLivingRange = -1;
+    int goal = 0;
+    int mapSize = 0;
+    std::vector<SoldierSnapshot> soldiers;
+    std::vector<EnemySnapshot> enemies;
+
+    std::vector<Drum> commands;
+    std::string lastEvent;
+    std::uint32_t attacks = 0;
+
+    bool won = false;
+    bool lost = false;
+    bool bossEventActive = false;
+    bool victoryMarching = false;
+    float bossEventTimer = 0.0f;
+    float victoryTimer = 0.0f;
+
+    GameStats stats;
+};
@@ -0,0 +1,53 @@
+#pragma once
+#include <memory>
+
+#include "Enemy.h"
+#include "Boss.h"
+#include "ChantBook.h"
+#include "GameConstants.h"
+
+// How long the march is and where the beast waves wait along it. The last
+// wave waits five tiles short of the goal, where the boss appears too; each
+// earlier wave waits waveSpacing tiles before the next one.
+struct MapLayout {
+    int length = GameConstants::MAP_SIZE;
+    int waves = 3;
+    int waveSpacing = 0;
+};
+
+// Prototypes that Game clones whenever it spawns a beast or the boss, plus the
+// chants the army answers to and the layout of the map.
+class Scenario {
+public:
+    explicit Scenario(std::shared_ptr<const ChantBook> chants = ChantBook::getDefault());
+    Scenario(const Enemy& beast, const Boss& boss,
+             std::shared_ptr<const ChantBook> chants = ChantBook::getDefault());
+    Scenario(const Scenario& other);
+    Scenario& operator=(Scenario other);
+    ~Scenario() = default;
+
+    friend void swap(Scenario& first, Scenario& second) noexcept;
+
+    [[nodiscard]] std::unique_ptr<Enemy> makeBeast(int pos) const;
+    [[nodiscard]] std::unique_ptr<Enemy> makeBoss(int pos) const;
+
+    [[nodiscard]] const Enemy& getBeast() const { return *m_beast; }
+    [[nodiscard]] const Boss& getBoss() const { return *m_boss; }
+    [[nodiscard]] const std::shared_ptr<const ChantBook>& getChants() const { return m_chants; }
+
+    void setLayout(const MapLayout& layout);
+    [[nodiscard]] const MapLayout& getLayout() const { return m_layout; }
+    [[nodiscard]] int getGoal() const { return m_layout.length - 1; }
+    [[nodiscard]] int getBossSpawn() const { return getGoal() - 5; }
+    [[nodiscard]] int getWaveSpawn(int wave) const {
+        return getBossSpawn() - (m_layout.waves - 1 - wave) * m_layout.waveSpacing;
+    }
+
+private:
+    std::unique_ptr<Enemy> m_beast;
+    std::unique_ptr<Boss> m_boss;
+    std::shared_ptr<const ChantBook> m_chants;
+    MapLayout m_layout;
+
+    static std::unique_ptr<Enemy> spawn(const Enemy& prototype, int pos);
+};
@@ -0,0 +1,31 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+
+// Collects untextured geometry as a triangle list, so a whole layer of
+// rectangles, circles and polygons reaches the GPU in a single draw call.
+// clear() keeps the vertex storage, so refilling it every frame does not
+// allocate once the batch has grown to its working size.
+class ShapeBatch : public sf::Drawable {
+public:
+    static constexpr std::size_t CIRCLE_POINTS = 30;
+
+    ShapeBatch();
+
+    void clear();
+
+    void addTriangle(sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Color color);
+    void addQuad(sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Vector2f d, sf::Color color);
+    void addRect(sf::Vector2f position, sf::Vector2f size, sf::Color color);
+    void addRectOutline(sf::Vector2f position, sf::Vector2f size, float thickness, sf::Color color);
+    void addCircle(sf::Vector2f center, float radius, sf::Color color);
+    void addRing(sf::Vector2f center, float innerRadius, float outerRadius, sf::Color color);
+
+    [[nodiscard]] std::size_t getVertexCount() const { return m_vertices.getVertexCount(); }
+
+private:
+    sf::VertexArray m_vertices;
+    std::array<sf::Vector2f, CIRCLE_POINTS> m_unitCircle;
+
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+};
@@ -0,0 +1,43 @@
+#pragma once
+#include <string>
+#include <vector>
+
+#include "DrumPolicy.h"
+#include "Game.h"
+#include "GameStats.h"
+
+class SimulationResult {
+public:
+    SimulationResult(bool won, bool lost, const GameStats& stats);
+
+    [[nodiscard]] bool hasWon() const { return m_won; }
+    [[nodiscard]] bool hasLost() const { return m_lost; }
+    [[nodiscard]] bool isFinished() const { return m_won || m_lost; }
+    [[nodiscard]] const GameStats& getStats() const { return m_stats; }
+
+private:
+    bool m_won;
+    bool m_lost;
+    GameStats m_stats;
+};
+
+// Drives a Game without a window: the boss reveal and the victory march, which
+// GameApplication times on the wall clock, are resolved immediately.
+class Simulation {
+public:
+    static constexpr int DEFAULT_MAX_TURNS = 10000;
+
+    explicit Simulation(int maxTurns = DEFAULT_MAX_TURNS);
+
+    // DEFAULT_MAX_TURNS per fifteen tiles of march, so long maps are not cut
+    // off long before the army could reach the goal.
+    [[nodiscard]] static int maxTurnsFor(const MapLayout& layout);
+
+    [[nodiscard]] SimulationResult run(Game& game, DrumPolicy& policy) const;
+    [[nodiscard]] static SimulationResult replay(Game& game, const std::vector<Drum>& drums);
+
+    static void settle(Game& game);
+
+private:
+    int m_maxTurns;
+};
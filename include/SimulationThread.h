@@ -0,0 +1,89 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include "Game.h"
+#include "RenderSnapshot.h"
+#include "SpscRing.h"
+#include "TripleBuffer.h"
+
+// When a drum press reached each stage. The window fills in the last one when
+// it presents the first frame drawn from a snapshot at or after tick.
+struct InputTrace {
+    std::chrono::steady_clock::time_point pressedAt;
+    std::chrono::steady_clock::time_point drainedAt;
+    std::chrono::steady_clock::time_point simulatedAt;
+    std::uint64_t tick;
+};
+
+// Runs a Game on its own thread at a fixed tick. The boss reveal and the
+// victory march are timed in ticks, so the outcome never depends on the
+// frame rate. Drums come in through a lock-free ring; after every tick the
+// game is copied into a RenderSnapshot and handed to the window through a
+// triple buffer, so neither side ever blocks the other. Each drum travels back
+// as an InputTrace, so the window can time it from key press to screen.
+class SimulationThread {
+public:
+    static constexpr int DEFAULT_TICK_RATE = 60;
+    static constexpr float BOSS_REVEAL_SECONDS = 2.0f;
+    static constexpr float VICTORY_MARCH_SECONDS = 3.0f;
+    static constexpr int SNAPSHOT_RADIUS = 32;
+
+    explicit SimulationThread(std::unique_ptr<Game> game, int tickRate = DEFAULT_TICK_RATE);
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    // Window thread. Returns false when the input ring is full.
+    bool submit(Drum drum, std::chrono::steady_clock::time_point pressedAt = std::chrono::steady_clock::now()) noexcept;
+    // Window thread. Traces of drums the simulation has played, oldest first.
+    bool pollTrace(InputTrace& trace) noexcept { return m_traces.pop(trace); }
+
+    // Window thread. Picks up the newest snapshot; false if there is none yet.
+    bool poll();
+    [[nodiscard]] const RenderSnapshot& getCurrent() const { return m_snapshots.front(); }
+    [[nodiscard]] const RenderSnapshot& getPrevious() const { return m_previous; }
+    // How far the window is between the previous and the current snapshot, in [0, 1].
+    [[nodiscard]] float getInterpolation() const;
+
+    [[nodiscard]] std::uint64_t getTicks() const { return m_tickCount.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr std::size_t INPUT_CAPACITY = 64;
+    static constexpr int MAX_CATCH_UP_TICKS = 5;
+
+    std::unique_ptr<Game> m_game;
+    std::chrono::steady_clock::duration m_tick;
+    float m_tickSeconds;
+
+    struct DrumInput {
+        Drum drum;
+        std::chrono::steady_clock::time_point pressedAt;
+    };
+
+    SpscRing<DrumInput, INPUT_CAPACITY> m_inputs;
+    SpscRing<InputTrace, INPUT_CAPACITY> m_traces;
+
+    TripleBuffer<RenderSnapshot> m_snapshots;
+    RenderSnapshot m_previous;
+
+    float m_bossEventTimer = 0.0f;
+    float m_victoryTimer = 0.0f;
+    std::uint32_t m_attacks = 0;
+    std::optional<CombatEvent> m_describedEvent;
+    std::string m_describedText;
+
+    std::atomic<std::uint64_t> m_tickCount{0};
+    std::atomic<bool> m_stopping{false};
+    std::thread m_thread;
+
+    void run();
+    void step();
+    void capture(RenderSnapshot& snapshot);
+};
@@ -0,0 +1,97 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "EntityId.h"
+
+// Values keyed by EntityId, stored densely. A sparse table indexed by
+// id.index points into the dense arrays; erase() moves the last value into
+// the hole, so iteration stays contiguous and lookups stay O(1). A lookup with
+// a stale generation misses instead of returning the slot's new owner.
+template<typename T>
+class SlotMap {
+public:
+    T& insert(EntityId id, T value) {
+        if (id.index >= m_slots.size()) {
+            m_slots.resize(static_cast<std::size_t>(id.index) + 1);
+        }
+        Slot& slot = m_slots[id.index];
+        slot.generation = id.generation;
+        if (slot.dense != EMPTY) {
+            m_keys[slot.dense] = id;
+            m_values[slot.dense] = std::move(value);
+            return m_values[slot.dense];
+        }
+        slot.dense = static_cast<std::uint32_t>(m_values.size());
+        m_keys.push_back(id);
+        m_values.push_back(std::move(value));
+        return m_values.back();
+    }
+
+    [[nodiscard]] T* find(EntityId id) {
+        const std::uint32_t dense = locate(id);
+        return dense == EMPTY ? nullptr : &m_values[dense];
+    }
+    [[nodiscard]] const T* find(EntityId id) const {
+        const std::uint32_t dense = locate(id);
+        return dense == EMPTY ? nullptr : &m_values[dense];
+    }
+    [[nodiscard]] bool contains(EntityId id) const { return locate(id) != EMPTY; }
+
+    void erase(EntityId id) {
+        const std::uint32_t dense = locate(id);
+        if (dense != EMPTY) {
+            eraseDense(dense);
+        }
+    }
+
+    template<typename Predicate>
+    void eraseIf(Predicate predicate) {
+        for (std::size_t i = m_values.size(); i-- > 0;) {
+            if (predicate(m_keys[i], m_values[i])) {
+                eraseDense(static_cast<std::uint32_t>(i));
+            }
+        }
+    }
+
+    void clear() {
+        m_slots.clear();
+        m_keys.clear();
+        m_values.clear();
+    }
+
+    [[nodiscard]] std::size_t size() const { return m_values.size(); }
+    [[nodiscard]] bool empty() const { return m_values.empty(); }
+
+private:
+    static constexpr std::uint32_t EMPTY = std::numeric_limits<std::uint32_t>::max();
+
+    struct Slot {
+        std::uint32_t generation = 0;
+        std::uint32_t dense = EMPTY;
+    };
+
+    std::vector<Slot> m_slots;
+    std::vector<EntityId> m_keys;
+    std::vector<T> m_values;
+
+    [[nodiscard]] std::uint32_t locate(EntityId id) const {
+        if (id.index >= m_slots.size()) return EMPTY;
+        const Slot& slot = m_slots[id.index];
+        return slot.generation == id.generation ? slot.dense : EMPTY;
+    }
+
+    void eraseDense(std::uint32_t dense) {
+        const std::uint32_t last = static_cast<std::uint32_t>(m_values.size() - 1);
+        m_slots[m_keys[dense].index].dense = EMPTY;
+        if (dense != last) {
+            m_keys[dense] = m_keys[last];
+            m_values[dense] = std::move(m_values[last]);
+            m_slots[m_keys[dense].index].dense = dense;
+        }
+        m_keys.pop_back();
+        m_values.pop_back();
+    }
+};
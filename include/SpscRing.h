@@ -0,0 +1,35 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// Fixed-size single-producer single-consumer queue. Neither side blocks:
+// push() fails when the ring is full and pop() when it is empty.
+template<typename T, std::size_t Capacity>
+class SpscRing {
+public:
+    bool push(const T& value) noexcept {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        m_items[head % Capacity] = value;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T& value) noexcept {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = m_items[tail % Capacity];
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    std::array<T, Capacity> m_items{};
+    alignas(64) std::atomic<std::size_t> m_head{0};
+    alignas(64) std::atomic<std::size_t> m_tail{0};
+};
@@ -0,0 +1,43 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <initializer_list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+enum class TextOrigin {
+    TOP_LEFT,
+    CENTER,
+    LABEL
+};
+
+// Persistent sf::Text objects addressed by slot. A slot's glyphs are laid out
+// again and its bounds recomputed only when its string, size, color or origin
+// changed since the previous frame, so per-frame text work scales with the
+// labels that changed, not with the labels on screen.
+class TextCache {
+public:
+    explicit TextCache(const sf::Font& font);
+
+    sf::Text& update(std::size_t slot, std::string_view content, unsigned size,
+                     sf::Color color = sf::Color::White, TextOrigin origin = TextOrigin::TOP_LEFT);
+
+    // Rasterizes the printable ASCII glyphs at every given size up front, so
+    // the font's texture pages never grow in the middle of a frame.
+    void prewarm(std::initializer_list<unsigned> sizes) const;
+
+    [[nodiscard]] unsigned getRebuildCount() const { return m_rebuildCount; }
+
+private:
+    struct Entry {
+        std::optional<sf::Text> text;
+        std::string content;
+        unsigned size = 0;
+        TextOrigin origin = TextOrigin::TOP_LEFT;
+    };
+
+    const sf::Font& m_font;
+    std::vector<Entry> m_entries;
+    unsigned m_rebuildCount = 0;
+};
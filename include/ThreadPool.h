@@ -0,0 +1,58 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <semaphore>
+#include <thread>
+#include <vector>
+
+// Work-stealing pool: every worker pops from the back of its own queue and,
+// when that runs dry, steals from the front of the others. Tasks receive the
+// index of the worker running them so callers can keep per-thread state.
+// Only the per-worker queues take locks. Idle workers sleep on a semaphore
+// holding one token per queued task, and wait() sleeps on the pending count.
+class ThreadPool {
+public:
+    using Task = std::function<void(std::size_t worker)>;
+
+    explicit ThreadPool(std::size_t threads = std::thread::hardware_concurrency());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void submit(Task task);
+    void wait();
+
+    [[nodiscard]] std::size_t size() const { return m_threads.size(); }
+
+private:
+    class WorkQueue {
+    public:
+        void push(Task task);
+        bool popBack(Task& task);
+        bool stealFront(Task& task);
+
+    private:
+        std::mutex m_mutex;
+        std::deque<Task> m_tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> m_queues;
+    std::vector<std::thread> m_threads;
+
+    std::counting_semaphore<> m_available{0};
+    std::atomic<std::size_t> m_pending{0};
+    std::atomic<std::size_t> m_nextQueue{0};
+    std::atomic<bool> m_stopping{false};
+    std::mutex m_errorMutex;
+    std::exception_ptr m_error;
+
+    void workerLoop(std::size_t index);
+    bool tryTake(std::size_t index, Task& task);
+    void finish(std::size_t index, Task& task);
+};
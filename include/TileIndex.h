@@ -0,0 +1,75 @@
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "EntityId.h"
+
+class Enemy;
+
+// Enemies bucketed by the tile they stand on. Each bucket is a doubly linked
+// list threaded through per-entity links (indexed by EntityId::index), so
+// insert, remove and move are O(1) and a bucket keeps its arrival order.
+// Only occupied tiles have a bucket, so memory follows the enemy count and
+// not the map length. Enemy::setPos reports moves here once the enemy has
+// been inserted.
+class TileIndex {
+public:
+    explicit TileIndex(int tiles);
+
+    TileIndex(const TileIndex&) = delete;
+    TileIndex& operator=(const TileIndex&) = delete;
+
+    void insert(Enemy& enemy);
+    void remove(Enemy& enemy);
+    void move(const Enemy& enemy, int from, int to);
+
+    [[nodiscard]] int getTileCount() const { return m_tileCount; }
+    [[nodiscard]] bool contains(int tile) const { return tile >= 0 && tile < m_tileCount; }
+    [[nodiscard]] std::size_t count(int tile) const {
+        const Bucket* bucket = find(tile);
+        return bucket ? bucket->count : 0;
+    }
+    [[nodiscard]] std::size_t getOccupiedTileCount() const { return m_buckets.size(); }
+    [[nodiscard]] Enemy* firstLiving(int tile) const;
+    [[nodiscard]] bool hasLiving(int tile) const { return firstLiving(tile) != nullptr; }
+    [[nodiscard]] std::size_t countLiving(int tile) const;
+
+    // Visits the enemies on a tile in arrival order. Out-of-range tiles are empty.
+    template<typename Visitor>
+    void forEach(int tile, Visitor visitor) const {
+        const Bucket* bucket = find(tile);
+        if (!bucket) return;
+        for (std::uint32_t i = bucket->head; i != NONE; i = m_links[i].next) {
+            visitor(*m_links[i].enemy);
+        }
+    }
+
+private:
+    static constexpr std::uint32_t NONE = EntityId::INVALID_INDEX;
+
+    struct Bucket {
+        std::uint32_t head = NONE;
+        std::uint32_t tail = NONE;
+        std::size_t count = 0;
+    };
+
+    struct Link {
+        Enemy* enemy = nullptr;
+        std::uint32_t prev = NONE;
+        std::uint32_t next = NONE;
+    };
+
+    int m_tileCount;
+    std::unordered_map<int, Bucket> m_buckets;
+    std::vector<Link> m_links;
+
+    [[nodiscard]] const Bucket* find(int tile) const {
+        const auto it = m_buckets.find(tile);
+        return it == m_buckets.end() ? nullptr : &it->second;
+    }
+
+    void link(std::uint32_t index, int tile);
+    void unlink(std::uint32_t index, int tile);
+    [[nodiscard]] std::uint32_t linkIndex(const Enemy& enemy) const;
+};
@@ -0,0 +1,39 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// Single-writer single-reader handoff of the latest value. The writer fills
+// back() and publishes it; the reader picks up the newest published value
+// with update() and keeps reading front() until the next one. Neither side
+// ever waits for the other, and a value the reader never saw is simply
+// overwritten.
+template<typename T>
+class TripleBuffer {
+public:
+    [[nodiscard]] T& back() { return m_buffers[m_back]; }
+
+    void publish() {
+        m_back = m_shared.exchange(static_cast<std::uint8_t>(m_back | FRESH), std::memory_order_acq_rel) & INDEX;
+    }
+
+    [[nodiscard]] bool hasFresh() const { return (m_shared.load(std::memory_order_acquire) & FRESH) != 0; }
+
+    // Returns false, leaving front() as it was, when nothing new was published.
+    bool update() {
+        if (!hasFresh()) return false;
+        m_front = m_shared.exchange(m_front, std::memory_order_acq_rel) & INDEX;
+        return true;
+    }
+
+    [[nodiscard]] const T& front() const { return m_buffers[m_front]; }
+
+private:
+    static constexpr std::uint8_t INDEX = 0x3;
+    static constexpr std::uint8_t FRESH = 0x4;
+
+    std::array<T, 3> m_buffers{};
+    std::uint8_t m_back = 0;
+    alignas(64) std::atomic<std::uint8_t> m_shared{1};
+    alignas(64) std::uint8_t m_front = 2;
+};
@@ -2,6 +2,8 @@
 #include <string>
 #include <memory>
 
+#include "EntityId.h"
+
 
 class Unit {
 public:
@@ -22,10 +24,13 @@ public:
     [[nodiscard]] int getMaxHP() const { return m_max_hp; }
     [[nodiscard]] int getATK() const { return m_atk; }
     [[nodiscard]] bool isAlive() const { return m_hp > 0; }
+    [[nodiscard]] EntityId getId() const { return m_id; }
+    void setId(EntityId id) { m_id = id; }
 
 protected:
     std::string m_name;
     int m_hp;
     int m_max_hp;
     int m_atk;
+    EntityId m_id;
 };
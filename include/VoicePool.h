@@ -0,0 +1,48 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+// A fixed set of voices sharing one decoded sample, so a hit never cuts off
+// the one before it. Voices are handed out round-robin, skipping busy ones;
+// when every voice is busy the one started longest ago is reused.
+//
+// update() estimates when each hit became audible from the voice's playing
+// offset and keeps the latency from key press to sound.
+class VoicePool {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t DEFAULT_VOICES = 4;
+
+    explicit VoicePool(const sf::SoundBuffer& buffer, std::size_t voices = DEFAULT_VOICES);
+
+    void play(Clock::time_point pressedAt);
+    void update();
+
+    [[nodiscard]] std::size_t getVoiceCount() const { return m_voices.size(); }
+    [[nodiscard]] std::uint64_t getPlays() const { return m_plays; }
+    [[nodiscard]] std::uint64_t getSteals() const { return m_steals; }
+    [[nodiscard]] std::uint64_t getMeasured() const { return m_measured; }
+    [[nodiscard]] std::chrono::microseconds getMeanLatency() const;
+    [[nodiscard]] std::chrono::microseconds getWorstLatency() const { return m_worstLatency; }
+
+private:
+    struct Voice {
+        explicit Voice(const sf::SoundBuffer& buffer) : sound(buffer) {}
+
+        sf::Sound sound;
+        std::uint64_t started = 0;
+        Clock::time_point pressedAt;
+        bool awaitingSound = false;
+    };
+
+    std::vector<Voice> m_voices;
+    std::size_t m_next = 0;
+    std::uint64_t m_plays = 0;
+    std::uint64_t m_steals = 0;
+    std::uint64_t m_measured = 0;
+    std::chrono::microseconds m_totalLatency{0};
+    std::chrono::microseconds m_worstLatency{0};
+};
@@ -7,5 +7,6 @@ public:
     
     [[nodiscard]] std::unique_ptr<Unit> clone() const override;
     [[nodiscard]] int getRange() const override;
+    [[nodiscard]] PataponType getType() const override;
     
 };
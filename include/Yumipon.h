@@ -7,6 +7,7 @@ public:
     
     [[nodiscard]] std::unique_ptr<Unit> clone() const override;
     [[nodiscard]] int getRange() const override;
+    [[nodiscard]] PataponType getType() const override;
     [[nodiscard]] int dealDamage() const override;
     
 };
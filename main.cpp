@@ -1,10 +1,47 @@
 #include "GameApplication.h"
 #include <iostream>
+#include <string_view>
 
-int main() {
+int main(int argc, char* argv[]) {
     try {
-        GameApplication app;
+        bool prewarmGlyphs = true;
+        bool trace = false;
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view arg(argv[i]);
+            if (arg == "--no-prewarm") prewarmGlyphs = false;
+            else if (arg == "--trace") trace = true;
+        }
+        GameApplication app(prewarmGlyphs);
+        if (trace) {
+#ifdef ENABLE_PROFILER
+            app.startTrace("trace.json");
+#else
+            std::cerr << "--trace needs a build with ENABLE_PROFILER" << std::endl;
+#endif
+        }
         app.run();
+        std::cout << "Assets loaded in " << app.getLoadTime().count() / 1000.0 << " ms" << std::endl;
+        for (const AssetTiming& timing : app.getAssetTimings()) {
+            std::cout << "  " << timing.path << ": decode " << timing.decode.count() / 1000.0 << " ms";
+            if (timing.upload.count() > 0) {
+                std::cout << ", upload " << timing.upload.count() / 1000.0 << " ms";
+            }
+            std::cout << std::endl;
+        }
+        for (std::size_t stage = 0; stage < GameApplication::LATENCY_STAGES.size(); ++stage) {
+            app.getInputLatency()[stage].print(std::cout, "Input " + std::string(GameApplication::LATENCY_STAGES[stage]));
+        }
+        for (Drum drum : {Drum::PATA, Drum::PON}) {
+            const VoicePool* voices = app.getDrumVoices(drum);
+            if (!voices || voices->getPlays() == 0) continue;
+            std::cout << (drum == Drum::PATA ? "PATA" : "PON") << ": " << voices->getPlays() << " hits, "
+                      << voices->getSteals() << " voices stolen, key-to-sound latency mean "
+                      << voices->getMeanLatency().count() / 1000.0 << " ms, worst "
+                      << voices->getWorstLatency().count() / 1000.0 << " ms over " << voices->getMeasured() << " hits"
+                      << std::endl;
+        }
+        std::cout << "Worst frame: " << app.getWorstFrame().asMicroseconds() / 1000.0 << " ms"
+                  << (prewarmGlyphs ? "" : " (no glyph prewarm)") << std::endl;
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
         return 1;
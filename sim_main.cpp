@@ -0,0 +1,242 @@
+#include "Army.h"
+#include "BatchSimulation.h"
+#include "DrumPolicy.h"
+#include "EventJournal.h"
+#include "Game.h"
+#include "GameConfig.h"
+#include "KeyScript.h"
+#include "LaneSimulation.h"
+#include "ParameterSweep.h"
+#include "Simulation.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    double secondsSince(std::chrono::steady_clock::time_point start) {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() > 0 ? elapsed.count() : 1e-9;
+    }
+
+    // oop-sim [games] [config] [seed]
+    void runBenchmark(int argc, char* argv[]) {
+        int games = argc > 1 ? std::stoi(argv[1]) : 1000;
+        std::string configPath = argc > 2 ? argv[2] : "assets/game_config.txt";
+        std::uint64_t baseSeed = argc > 3 ? std::stoull(argv[3]) : 1;
+        if (games <= 0) {
+            throw InvalidInputException("Number of games must be positive");
+        }
+
+        const auto config = GameConfig::load(configPath);
+        const Army army(config->getSoldiers(), 0);
+        const Scenario& scenario = config->getScenario();
+        const Simulation simulation(Simulation::maxTurnsFor(scenario.getLayout()));
+        ScriptedPolicy policy({Drum::PATA, Drum::PATA, Drum::PATA, Drum::PON,
+                               Drum::PON, Drum::PON, Drum::PATA, Drum::PON});
+
+        int won = 0, lost = 0;
+        long long turns = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < games; ++i) {
+            Game game(army, {}, baseSeed + static_cast<std::uint64_t>(i), scenario);
+            policy.reset(0);
+            SimulationResult result = simulation.run(game, policy);
+            if (result.hasWon()) ++won;
+            else if (result.hasLost()) ++lost;
+            turns += result.getStats().getTurns();
+        }
+        double seconds = secondsSince(start);
+
+        std::cout << "Games: " << games << " (won " << won << ", lost " << lost
+                  << ", unfinished " << games - won - lost << ")\n"
+                  << "Turns: " << turns << "\n"
+                  << "Elapsed: " << seconds << " s\n"
+                  << "Games/sec: " << games / seconds << "\n"
+                  << "Turns/sec: " << static_cast<double>(turns) / seconds << std::endl;
+    }
+
+    std::unique_ptr<DrumPolicy> makePolicy(const std::string& spec, const Scenario& scenario) {
+        if (spec == "random") {
+            return std::make_unique<RandomChantPolicy>(scenario.getChants());
+        }
+        return std::make_unique<ScriptedPolicy>(KeyScript::loadFromFile(spec).getDrums());
+    }
+
+    // oop-sim batch <games> [random|script file] [config] [seed] [threads]
+    void runBatch(int argc, char* argv[]) {
+        long long games = argc > 2 ? std::stoll(argv[2]) : 100000;
+        std::string policySpec = argc > 3 ? argv[3] : "random";
+        std::string configPath = argc > 4 ? argv[4] : "assets/game_config.txt";
+        std::uint64_t baseSeed = argc > 5 ? std::stoull(argv[5]) : 1;
+        std::size_t threads = argc > 6 ? std::stoul(argv[6]) : std::thread::hardware_concurrency();
+
+        const auto config = GameConfig::load(configPath);
+        const Army army(config->getSoldiers(), 0);
+        const Scenario& scenario = config->getScenario();
+        const BatchSimulation batch(army, *makePolicy(policySpec, scenario), scenario,
+                                    Simulation::maxTurnsFor(scenario.getLayout()));
+        ThreadPool pool(threads);
+
+        auto start = std::chrono::steady_clock::now();
+        BatchStats stats = batch.run(games, baseSeed, pool);
+        double seconds = secondsSince(start);
+
+        std::cout << stats << "\n"
+                  << "Threads: " << pool.size() << "\n"
+                  << "Elapsed: " << seconds << " s\n"
+                  << "Games/sec: " << static_cast<double>(stats.getGames()) / seconds << "\n"
+                  << "Turns/sec: " << static_cast<double>(stats.getTurns()) / seconds << std::endl;
+    }
+
+    template <int LANES>
+    BatchStats runLaneBatch(const Army& army, const DrumPolicy& policy, const Scenario& scenario,
+                            long long games, std::uint64_t baseSeed, ThreadPool& pool) {
+        const LaneSimulation<LANES> lanes(army, policy, scenario, Simulation::maxTurnsFor(scenario.getLayout()));
+        return lanes.run(games, baseSeed, pool);
+    }
+
+    // oop-sim lanes <games> [random|script file] [config] [seed] [threads] [8|16]
+    void runLanes(int argc, char* argv[]) {
+        long long games = argc > 2 ? std::stoll(argv[2]) : 100000;
+        std::string policySpec = argc > 3 ? argv[3] : "random";
+        std::string configPath = argc > 4 ? argv[4] : "assets/game_config.txt";
+        std::uint64_t baseSeed = argc > 5 ? std::stoull(argv[5]) : 1;
+        std::size_t threads = argc > 6 ? std::stoul(argv[6]) : std::thread::hardware_concurrency();
+        int width = argc > 7 ? std::stoi(argv[7]) : 8;
+        if (width != 8 && width != 16) {
+            throw InvalidInputException("Lane width must be 8 or 16");
+        }
+
+        const auto config = GameConfig::load(configPath);
+        const Army army(config->getSoldiers(), 0);
+        const Scenario& scenario = config->getScenario();
+        const auto policy = makePolicy(policySpec, scenario);
+        ThreadPool pool(threads);
+
+        auto start = std::chrono::steady_clock::now();
+        BatchStats stats = width == 16 ? runLaneBatch<16>(army, *policy, scenario, games, baseSeed, pool)
+                                       : runLaneBatch<8>(army, *policy, scenario, games, baseSeed, pool);
+        double seconds = secondsSince(start);
+
+        std::cout << stats << "\n"
+                  << "Lanes: " << width << "\n"
+                  << "Threads: " << pool.size() << "\n"
+                  << "Elapsed: " << seconds << " s\n"
+                  << "Games/sec: " << static_cast<double>(stats.getGames()) / seconds << "\n"
+                  << "Turns/sec: " << static_cast<double>(stats.getTurns()) / seconds << std::endl;
+    }
+
+    // oop-sim sweep <sweep file> [output csv] [random|script file] [config] [threads]
+    void runSweep(int argc, char* argv[]) {
+        if (argc < 3) {
+            throw InvalidInputException("Usage: oop-sim sweep <sweep file> [output csv] [random|script file] [config] [threads]");
+        }
+        std::string outputPath = argc > 3 ? argv[3] : "sweep_results.csv";
+        std::string policySpec = argc > 4 ? argv[4] : "random";
+        std::string configPath = argc > 5 ? argv[5] : "assets/game_config.txt";
+        std::size_t threads = argc > 6 ? std::stoul(argv[6]) : std::thread::hardware_concurrency();
+
+        const ParameterSweep sweep = ParameterSweep::loadFromFile(argv[2]);
+        const auto config = GameConfig::load(configPath);
+        const auto& soldiers = config->getSoldiers();
+        const Scenario& scenario = config->getScenario();
+        ThreadPool pool(threads);
+
+        std::ofstream csv(outputPath);
+        if (!csv.is_open()) {
+            throw ResourceLoadException("Failed to open output file: " + outputPath);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        sweep.run(soldiers, scenario, *makePolicy(policySpec, scenario), pool, csv);
+        double seconds = secondsSince(start);
+
+        std::cout << "Configurations: " << sweep.sampleConfigurations().size() << "\n"
+                  << "Results: " << outputPath << "\n"
+                  << "Elapsed: " << seconds << " s" << std::endl;
+    }
+
+    // oop-sim replay <script file or directory> [config] [seed] [journal file]
+    void runReplay(int argc, char* argv[]) {
+        if (argc < 3) {
+            throw InvalidInputException("Usage: oop-sim replay <script file or directory> [config] [seed] [journal file]");
+        }
+        std::string configPath = argc > 3 ? argv[3] : "assets/game_config.txt";
+        std::uint64_t seed = argc > 4 ? std::stoull(argv[4]) : 1;
+        std::unique_ptr<EventJournal> journal = argc > 5 ? std::make_unique<EventJournal>(argv[5]) : nullptr;
+
+        const std::vector<KeyScript> scripts = KeyScript::loadAll(argv[2]);
+        const auto config = GameConfig::load(configPath);
+        const Army army(config->getSoldiers(), 0);
+        const Scenario& scenario = config->getScenario();
+
+        long long keys = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (const auto& script : scripts) {
+            Game game(army, {}, seed, scenario);
+            game.setJournal(journal.get());
+            SimulationResult result = Simulation::replay(game, script.getDrums());
+            keys += static_cast<long long>(script.getDrums().size());
+
+            const char* outcome = result.hasWon() ? "CASTIGAT" : (result.hasLost() ? "PIERDUT" : "NETERMINAT");
+            std::cout << script.getName() << ": " << outcome << " | " << result.getStats() << "\n";
+        }
+        double seconds = secondsSince(start);
+
+        std::cout << "Scripts: " << scripts.size() << ", keys: " << keys << "\n"
+                  << "Elapsed: " << seconds << " s\n"
+                  << "Keys/sec: " << static_cast<double>(keys) / seconds << std::endl;
+
+        if (journal) {
+            journal->close();
+            std::cout << "Journal: " << argv[5] << " (" << journal->getWritten() << " events)" << std::endl;
+            if (journal->getDropped() > 0) {
+                throw InvalidStateException("Journal dropped " + std::to_string(journal->getDropped()) + " events");
+            }
+        }
+    }
+
+    bool isNumber(const std::string& text) {
+        return !text.empty() && std::ranges::all_of(text, [](unsigned char c) { return std::isdigit(c) != 0; });
+    }
+
+    void printUsage() {
+        std::cerr << "Usage:\n"
+                  << "  oop-sim [games] [config] [seed]\n"
+                  << "  oop-sim batch <games> [random|script file] [config] [seed] [threads]\n"
+                  << "  oop-sim lanes <games> [random|script file] [config] [seed] [threads] [8|16]\n"
+                  << "  oop-sim sweep <sweep file> [output csv] [random|script file] [config] [threads]\n"
+                  << "  oop-sim replay <script file or directory> [config] [seed] [journal file]" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        std::string mode = argc > 1 ? argv[1] : "";
+        if (mode == "replay") {
+            runReplay(argc, argv);
+        } else if (mode == "batch") {
+            runBatch(argc, argv);
+        } else if (mode == "sweep") {
+            runSweep(argc, argv);
+        } else if (mode == "lanes") {
+            runLanes(argc, argv);
+        } else if (mode.empty() || isNumber(mode)) {
+            runBenchmark(argc, argv);
+        } else {
+            printUsage();
+            return 1;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -5,29 +5,30 @@
 
 Army::Army(const std::vector<std::unique_ptr<Patapon>>& soldiers, int position)
     : m_position(position) {
-    if (soldiers.empty()) {
-        throw InvalidInputException("Army must have at least one soldier");
-    }
-    m_soldiers.reserve(soldiers.size());
     for (const auto& s : soldiers) {
         if (s) {
-             auto clonedUnit = s->clone();
-             if (auto clonedPatapon = std::unique_ptr<Patapon>(dynamic_cast<Patapon*>(clonedUnit.release()))) {
-                 m_soldiers.push_back(std::move(clonedPatapon));
-             }
+            m_names.push_back(s->getName());
+            m_hp.push_back(s->getHP());
+            m_maxHp.push_back(s->getMaxHP());
+            m_atk.push_back(s->getATK());
+            m_damage.push_back(s->dealDamage());
+            m_def.push_back(s->getDEF());
+            m_range.push_back(std::max(0, s->getRange()));
+            m_type.push_back(s->getType());
         }
     }
-}
+    if (m_hp.empty()) {
+        throw InvalidInputException("Army must have at least one soldier");
+    }
 
-Army::Army(const Army& other)
-    : m_position(other.m_position) {
-    m_soldiers.reserve(other.m_soldiers.size());
-    for (const auto& p : other.m_soldiers) {
-         auto clonedUnit = p->clone();
-         if (auto clonedPatapon = std::unique_ptr<Patapon>(dynamic_cast<Patapon*>(clonedUnit.release()))) {
-             m_soldiers.push_back(std::move(clonedPatapon));
-         }
+    const int longestRange = *std::ranges::max_element(m_range);
+    m_livingByRange.assign(static_cast<std::size_t>(longestRange) + 1, 0);
+    m_damageWithin.assign(static_cast<std::size_t>(longestRange) + 1, 0);
+    for (std::size_t i = 0; i < m_hp.size(); ++i) {
+        if (m_hp[i] > 0) addLiving(i);
     }
+    m_front = 0;
+    while (m_front < m_hp.size() && m_hp[m_front] <= 0) ++m_front;
 }
 
 Army& Army::operator=(Army other) {
@@ -37,8 +38,21 @@ Army& Army::operator=(Army other) {
 
 void swap(Army& first, Army& second) noexcept {
     using std::swap;
-    swap(first.m_soldiers, second.m_soldiers);
+    swap(first.m_names, second.m_names);
+    swap(first.m_hp, second.m_hp);
+    swap(first.m_maxHp, second.m_maxHp);
+    swap(first.m_atk, second.m_atk);
+    swap(first.m_damage, second.m_damage);
+    swap(first.m_def, second.m_def);
+    swap(first.m_range, second.m_range);
+    swap(first.m_type, second.m_type);
     swap(first.m_position, second.m_position);
+    swap(first.m_livingCount, second.m_livingCount);
+    swap(first.m_livingDefense, second.m_livingDefense);
+    swap(first.m_maxLivingRange, second.m_maxLivingRange);
+    swap(first.m_front, second.m_front);
+    swap(first.m_livingByRange, second.m_livingByRange);
+    swap(first.m_damageWithin, second.m_damageWithin);
 }
 
 void Army::moveForward(int steps) {
@@ -54,67 +68,54 @@ void Army::moveBackward(int steps) {
     if (m_position < 0) m_position = 0;
 }
 
-void Army::attackEnemies(std::vector<std::unique_ptr<Enemy>>& enemies, std::vector<std::string>& log, GameStats& stats) const {
+// Hits the nearest living enemy ahead that at least one soldier can reach,
+// walking the tiles outward instead of sorting every enemy by position.
+void Army::attackEnemies(const TileIndex& tiles, EventLog& events, GameStats& stats) {
     if (!hasLivingSoldiers()) return;
-    
-    std::ranges::sort(enemies, [](const std::unique_ptr<Enemy>& a, const std::unique_ptr<Enemy>& b) {
-        return a->getPos() < b->getPos();
-    });
-    
-    for (auto& e : enemies) {
-        if (!e->isAlive()) continue;
-        int dist = e->getPos() - m_position;
-        if (dist < 0) continue;
-        int dmg = 0;
-        
-        for (const auto& p : m_soldiers) {
-            if (!p->isAlive()) continue;
-            
-            int r = p->getRange(); 
-            if (dist <= r) dmg += p->dealDamage();
-        }
-        
+
+    for (int dist = 0; dist <= m_maxLivingRange; ++dist) {
+        Enemy* e = tiles.firstLiving(m_position + dist);
+        if (!e) continue;
+        int dmg = m_damageWithin[static_cast<std::size_t>(dist)];
+
         if (dmg > 0) {
             int oldHP = e->getHP();
             e->takeDamage(dmg);
             int damageDealt = oldHP - e->getHP();
             stats.addDamageDealt(damageDealt);
-            log.push_back("Armata a atacat " + e->getName() + " iar acesta a pierdut " + std::to_string(damageDealt) + " HP!");
+            events.push(CombatEventKind::ENEMY_HIT, CombatEvent::NONE, CombatEvent::enemy(*e), damageDealt);
 
             if (e->isAlive()) {
                 int retaliate = std::max(1, e->dealDamage() - averageDefense());
-                for (const auto& p : m_soldiers) {
-                    if (p->isAlive()) {
-                        int currentHP = p->getHP();
-                        int actualDamage = std::min(currentHP, retaliate);
-                        p->takeDamage(retaliate);
-                        
-                        stats.addDamageTaken(actualDamage);
-                        log.push_back(e->getName() + " a contraatacat " + p->getName() + " iar acesta a pierdut " + std::to_string(actualDamage) + " HP!");
-                        break;
-                    }
+                int target = firstLivingSoldier();
+                if (target >= 0) {
+                    auto i = static_cast<std::size_t>(target);
+                    int actualDamage = std::min(m_hp[i], retaliate);
+                    applyDamage(i, retaliate);
+
+                    stats.addDamageTaken(actualDamage);
+                    events.push(CombatEventKind::COUNTERATTACK, CombatEvent::enemy(*e), target, actualDamage);
                 }
             } else {
-                log.push_back(e->getName() + " a fost invins!");
+                events.push(CombatEventKind::ENEMY_DEFEATED, CombatEvent::NONE, CombatEvent::enemy(*e));
             }
             break;
         }
     }
 }
 
-void Army::receiveEnemyAttack(int dmg, const std::string& enemyName, std::vector<std::string>& log, GameStats& stats) {
-    for (auto& p : m_soldiers) {
-        if (p->isAlive()) {
-            int oldHP = p->getHP();
-            p->takeDamage(dmg);
-            int damageTaken = oldHP - p->getHP();
-            stats.addDamageTaken(damageTaken);
-            log.push_back(enemyName + " a atacat " + p->getName() + " iar acesta a pierdut " + std::to_string(damageTaken) + " HP!");
-            if (!p->isAlive()) {
-                log.push_back(p->getName() + " a fost invins!");
-            }
-            break;
-        }
+void Army::receiveEnemyAttack(int dmg, const Enemy& attacker, EventLog& events, GameStats& stats) {
+    int target = firstLivingSoldier();
+    if (target < 0) return;
+
+    auto i = static_cast<std::size_t>(target);
+    int oldHP = m_hp[i];
+    applyDamage(i, dmg);
+    int damageTaken = oldHP - m_hp[i];
+    stats.addDamageTaken(damageTaken);
+    events.push(CombatEventKind::SOLDIER_HIT, CombatEvent::enemy(attacker), target, damageTaken);
+    if (m_hp[i] <= 0) {
+        events.push(CombatEventKind::SOLDIER_DEFEATED, CombatEvent::NONE, target);
     }
 }
 
@@ -122,14 +123,54 @@ void Army::receiveEnemyAttack(int dmg, const std::string& enemyName, std::vector
 
 
 int Army::averageDefense() const {
-    int sum = 0, count = 0;
-    for (const auto& p : m_soldiers) {
-        if (p->isAlive()) {
-            sum += p->getDEF();
-            ++count;
-        }
+    return m_livingCount ? (m_livingDefense / m_livingCount) : 0;
+}
+
+// Soldiers fall front to back, so m_front only moves forward unless someone
+// ahead of it is healed back up.
+int Army::firstLivingSoldier() const {
+    return m_front < m_hp.size() ? static_cast<int>(m_front) : -1;
+}
+
+void Army::applyDamage(std::size_t index, int dmg) {
+    const bool wasAlive = m_hp[index] > 0;
+    if (dmg < 0) {
+        m_hp[index] = std::min(m_maxHp[index], m_hp[index] - dmg);
+    } else {
+        int effective = std::max(1, dmg - m_def[index]);
+        m_hp[index] = std::max(0, m_hp[index] - effective);
+    }
+
+    const bool alive = m_hp[index] > 0;
+    if (wasAlive && !alive) {
+        removeLiving(index);
+        while (m_front < m_hp.size() && m_hp[m_front] <= 0) ++m_front;
+    } else if (!wasAlive && alive) {
+        addLiving(index);
+        m_front = std::min(m_front, index);
     }
-    return count ? (sum / count) : 0;
 }
 
+void Army::addLiving(std::size_t index) {
+    const int range = m_range[index];
+    ++m_livingCount;
+    m_livingDefense += m_def[index];
+    ++m_livingByRange[static_cast<std::size_t>(range)];
+    m_maxLivingRange = std::max(m_maxLivingRange, range);
+    for (int d = 0; d <= range; ++d) {
+        m_damageWithin[static_cast<std::size_t>(d)] += m_damage[index];
+    }
+}
 
+void Army::removeLiving(std::size_t index) {
+    const int range = m_range[index];
+    --m_livingCount;
+    m_livingDefense -= m_def[index];
+    --m_livingByRange[static_cast<std::size_t>(range)];
+    while (m_maxLivingRange >= 0 && m_livingByRange[static_cast<std::size_t>(m_maxLivingRange)] == 0) {
+        --m_maxLivingRange;
+    }
+    for (int d = 0; d <= range; ++d) {
+        m_damageWithin[static_cast<std::size_t>(d)] -= m_damage[index];
+    }
+}
@@ -0,0 +1,102 @@
+#include "AssetLoader.h"
+#include "GameException.h"
+#include <algorithm>
+
+namespace {
+    std::chrono::microseconds since(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    }
+}
+
+AssetLoader::AssetLoader(std::size_t threads)
+    : m_pool(std::min(threads, MAX_THREADS)),
+      m_started(std::chrono::steady_clock::now()) {
+}
+
+template<typename Decode>
+void AssetLoader::add(const std::string& path, sf::Texture* texture, bool required, Decode decode) {
+    auto& entry = *m_entries.emplace_back(std::make_unique<Entry>());
+    entry.timing.path = path;
+    entry.texture = texture;
+    entry.required = required;
+    m_pool.submit([&entry, decode = std::move(decode)](std::size_t) {
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            if (!decode(entry)) {
+                throw ResourceLoadException("Failed to load asset: " + entry.timing.path);
+            }
+        } catch (...) {
+            entry.error = std::current_exception();
+        }
+        entry.timing.decode = since(start);
+        entry.decoded.store(true, std::memory_order_release);
+    });
+}
+
+void AssetLoader::addTexture(const std::string& path, sf::Texture& target) {
+    add(path, &target, true, [path](Entry& entry) { return entry.image.loadFromFile(path); });
+}
+
+void AssetLoader::addImage(const std::string& path, sf::Image& target, bool required) {
+    add(path, nullptr, required, [path, &target](Entry&) { return target.loadFromFile(path); });
+}
+
+void AssetLoader::addSound(const std::string& path, sf::SoundBuffer& target) {
+    add(path, nullptr, true, [path, &target](Entry&) { return target.loadFromFile(path); });
+}
+
+void AssetLoader::addFont(const std::vector<std::string>& paths, sf::Font& target) {
+    std::string label;
+    for (const auto& path : paths) {
+        label += label.empty() ? path : " or " + path;
+    }
+    add(label, nullptr, true, [paths, &target](Entry&) {
+        return std::ranges::any_of(paths, [&target](const std::string& path) { return target.openFromFile(path); });
+    });
+}
+
+bool AssetLoader::poll() {
+    for (auto& entry : m_entries) {
+        if (entry->done || !entry->decoded.load(std::memory_order_acquire)) continue;
+
+        if (entry->texture && !entry->error) {
+            const auto start = std::chrono::steady_clock::now();
+            if (!entry->texture->loadFromImage(entry->image)) {
+                entry->error = std::make_exception_ptr(
+                    ResourceLoadException("Failed to upload texture: " + entry->timing.path));
+            }
+            entry->timing.upload = since(start);
+            entry->image = sf::Image();
+        }
+        entry->done = true;
+        if (++m_finished == m_entries.size()) {
+            m_completed = std::chrono::steady_clock::now();
+        }
+    }
+    if (m_finished < m_entries.size()) return false;
+
+    for (const auto& entry : m_entries) {
+        if (entry->error && entry->required) {
+            std::rethrow_exception(entry->error);
+        }
+    }
+    return true;
+}
+
+float AssetLoader::getProgress() const {
+    return m_entries.empty() ? 1.0f : static_cast<float>(m_finished) / static_cast<float>(m_entries.size());
+}
+
+std::vector<AssetTiming> AssetLoader::getTimings() const {
+    std::vector<AssetTiming> timings;
+    for (const auto& entry : m_entries) {
+        if (entry->done) timings.push_back(entry->timing);
+    }
+    return timings;
+}
+
+std::chrono::microseconds AssetLoader::getElapsed() const {
+    if (m_entries.empty()) return std::chrono::microseconds{0};
+    const auto end = m_finished == m_entries.size() ? m_completed : std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - m_started);
+}
@@ -0,0 +1,96 @@
+#include "BatchSimulation.h"
+#include "GameException.h"
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+void BatchStats::record(const SimulationResult& result) {
+    const GameStats& stats = result.getStats();
+    ++m_games;
+    m_turns += stats.getTurns();
+    m_damageDealt += stats.getDamageDealt();
+    m_damageTaken += stats.getDamageTaken();
+    if (result.hasWon()) {
+        ++m_wins;
+        m_turnsToWin += stats.getTurns();
+    } else if (result.hasLost()) {
+        ++m_losses;
+    }
+}
+
+void BatchStats::merge(const BatchStats& other) {
+    m_games += other.m_games;
+    m_wins += other.m_wins;
+    m_losses += other.m_losses;
+    m_turns += other.m_turns;
+    m_turnsToWin += other.m_turnsToWin;
+    m_damageDealt += other.m_damageDealt;
+    m_damageTaken += other.m_damageTaken;
+}
+
+double BatchStats::getWinRate() const {
+    return m_games ? static_cast<double>(m_wins) / static_cast<double>(m_games) : 0.0;
+}
+
+double BatchStats::getAverageTurns() const {
+    return m_games ? static_cast<double>(m_turns) / static_cast<double>(m_games) : 0.0;
+}
+
+double BatchStats::getAverageTurnsToWin() const {
+    return m_wins ? static_cast<double>(m_turnsToWin) / static_cast<double>(m_wins) : 0.0;
+}
+
+double BatchStats::getAverageDamageDealt() const {
+    return m_games ? static_cast<double>(m_damageDealt) / static_cast<double>(m_games) : 0.0;
+}
+
+double BatchStats::getAverageDamageTaken() const {
+    return m_games ? static_cast<double>(m_damageTaken) / static_cast<double>(m_games) : 0.0;
+}
+
+std::ostream& operator<<(std::ostream& os, const BatchStats& stats) {
+    os << "Games: " << stats.m_games
+       << " (won " << stats.m_wins << ", lost " << stats.m_losses
+       << ", unfinished " << stats.m_games - stats.m_wins - stats.m_losses << ")\n"
+       << "Win rate: " << stats.getWinRate() * 100.0 << "%\n"
+       << "Average turns to win: " << stats.getAverageTurnsToWin() << "\n"
+       << "Average damage dealt: " << stats.getAverageDamageDealt() << "\n"
+       << "Average damage taken: " << stats.getAverageDamageTaken();
+    return os;
+}
+
+BatchSimulation::BatchSimulation(const Army& army, const DrumPolicy& policy, Scenario scenario, int maxTurns)
+    : m_army(army), m_scenario(std::move(scenario)), m_policy(policy.clone()), m_simulation(maxTurns) {}
+
+BatchStats BatchSimulation::run(long long games, std::uint64_t baseSeed, ThreadPool& pool) const {
+    if (games <= 0) {
+        throw InvalidInputException("Number of games must be positive");
+    }
+
+    std::vector<BatchStats> perWorker(pool.size());
+    for (long long first = 0; first < games; first += GAMES_PER_TASK) {
+        long long last = std::min(games, first + GAMES_PER_TASK);
+        pool.submit([this, &perWorker, first, last, baseSeed](std::size_t worker) {
+            perWorker[worker].merge(runRange(first, last, baseSeed));
+        });
+    }
+    pool.wait();
+
+    BatchStats total;
+    for (const auto& stats : perWorker) {
+        total.merge(stats);
+    }
+    return total;
+}
+
+BatchStats BatchSimulation::runRange(long long first, long long last, std::uint64_t baseSeed) const {
+    std::unique_ptr<DrumPolicy> policy = m_policy->clone();
+    BatchStats stats;
+    for (long long i = first; i < last; ++i) {
+        std::uint64_t seed = baseSeed + static_cast<std::uint64_t>(i);
+        Game game(m_army, {}, seed, m_scenario);
+        policy->reset(seed);
+        stats.record(m_simulation.run(game, *policy));
+    }
+    return stats;
+}
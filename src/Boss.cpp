@@ -29,6 +29,7 @@ std::string Boss::getDeathMessage() const {
     return "GENERALUL ZIGOTON A FOST INVINS!";
 }
 
+int Boss::getBonusDamage() const { return m_bonusDamage; }
 bool Boss::isCharging() const { return m_isCharging; }
 void Boss::startCharge() { m_isCharging = true; m_chargeTurns = 0; }
 void Boss::resetCharge() { m_isCharging = false; m_chargeTurns = 0; }
@@ -0,0 +1,33 @@
+#include "CachedLayer.h"
+#include "GameException.h"
+
+void CachedLayer::draw(sf::RenderTarget& target, const Bake& bake) {
+    const sf::Vector2u size = target.getSize();
+    if (m_texture.getSize() != size) {
+        if (!m_texture.resize(size)) {
+            throw ResourceLoadException("Failed to create render texture for a cached layer");
+        }
+        m_dirty = true;
+    }
+
+    const sf::View& view = target.getView();
+    if (view.getCenter() != m_bakedCenter || view.getSize() != m_bakedSize) {
+        m_dirty = true;
+    }
+
+    if (m_dirty) {
+        m_bakedCenter = view.getCenter();
+        m_bakedSize = view.getSize();
+        m_texture.setView(view);
+        m_texture.clear(sf::Color::Transparent);
+        bake(m_texture);
+        m_texture.display();
+        m_dirty = false;
+        ++m_bakeCount;
+    }
+
+    const sf::View worldView = view;
+    target.setView(sf::View(sf::FloatRect({0, 0}, sf::Vector2f(size))));
+    target.draw(sf::Sprite(m_texture.getTexture()));
+    target.setView(worldView);
+}
@@ -0,0 +1,95 @@
+#include "ChantBook.h"
+#include "GameException.h"
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <utility>
+
+ChantBook::ChantBook(std::vector<Entry> entries)
+    : m_entries(std::move(entries)), m_maxLength(0) {
+    if (m_entries.empty()) {
+        throw InvalidInputException("Chant book must contain at least one chant");
+    }
+    for (const auto& entry : m_entries) {
+        if (entry.chant == Chant::NONE) {
+            throw InvalidInputException("Chant book entry has no command");
+        }
+        if (entry.drums.empty() || entry.drums.size() > MAX_CHANT_LENGTH) {
+            throw InvalidInputException("Chants must have between 1 and " + std::to_string(MAX_CHANT_LENGTH) + " drums");
+        }
+        m_maxLength = std::max(m_maxLength, entry.drums.size());
+    }
+    compile();
+}
+
+std::shared_ptr<const ChantBook> ChantBook::getDefault() {
+    static const std::shared_ptr<const ChantBook> chants = std::make_shared<const ChantBook>(std::vector<Entry>{
+        {Chant::MOVE, {Drum::PATA, Drum::PATA, Drum::PATA, Drum::PON}},
+        {Chant::ATTACK, {Drum::PON, Drum::PON, Drum::PATA, Drum::PON}},
+        {Chant::RETREAT, {Drum::PON, Drum::PATA, Drum::PON, Drum::PATA}}
+    });
+    return chants;
+}
+
+const std::vector<Drum>* ChantBook::find(Chant chant) const {
+    for (const auto& entry : m_entries) {
+        if (entry.chant == chant) return &entry.drums;
+    }
+    return nullptr;
+}
+
+void ChantBook::compile() {
+    constexpr int NO_STATE = -1;
+    constexpr std::size_t NO_ENTRY = std::numeric_limits<std::size_t>::max();
+
+    std::vector<int> next = {NO_STATE, NO_STATE};
+    std::vector<std::size_t> firstEntry = {NO_ENTRY};
+
+    for (std::size_t i = 0; i < m_entries.size(); ++i) {
+        int state = 0;
+        for (Drum drum : m_entries[i].drums) {
+            const std::size_t edge = static_cast<std::size_t>(state) * 2 + static_cast<std::size_t>(drum);
+            if (next[edge] == NO_STATE) {
+                next[edge] = static_cast<int>(firstEntry.size());
+                next.insert(next.end(), {NO_STATE, NO_STATE});
+                firstEntry.push_back(NO_ENTRY);
+            }
+            state = next[edge];
+        }
+        firstEntry[static_cast<std::size_t>(state)] = std::min(firstEntry[static_cast<std::size_t>(state)], i);
+    }
+
+    std::vector<int> fail(firstEntry.size(), 0);
+    std::queue<int> pending;
+    for (std::size_t d = 0; d < 2; ++d) {
+        if (next[d] == NO_STATE) {
+            next[d] = 0;
+        } else {
+            pending.push(next[d]);
+        }
+    }
+
+    while (!pending.empty()) {
+        const auto state = static_cast<std::size_t>(pending.front());
+        pending.pop();
+
+        const auto fallback = static_cast<std::size_t>(fail[state]);
+        firstEntry[state] = std::min(firstEntry[state], firstEntry[fallback]);
+
+        for (std::size_t d = 0; d < 2; ++d) {
+            const int child = next[state * 2 + d];
+            if (child == NO_STATE) {
+                next[state * 2 + d] = next[fallback * 2 + d];
+            } else {
+                fail[static_cast<std::size_t>(child)] = next[fallback * 2 + d];
+                pending.push(child);
+            }
+        }
+    }
+
+    m_next = std::move(next);
+    m_match.resize(firstEntry.size());
+    std::ranges::transform(firstEntry, m_match.begin(), [this](std::size_t entry) {
+        return entry == NO_ENTRY ? Chant::NONE : m_entries[entry].chant;
+    });
+}
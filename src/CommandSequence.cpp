@@ -1,37 +1,30 @@
 #include "CommandSequence.h"
-
-CommandSequence::CommandSequence() {}
-
-CommandSequence::CommandSequence(const std::vector<std::string>& initialCommands)
-    : m_seq(initialCommands) {}
-
-void CommandSequence::push(const std::string &cmd) {
-    m_seq.push_back(cmd);
-    if (m_seq.size() > m_maxHistory) m_seq.erase(m_seq.begin());
+#include "GameException.h"
+#include <algorithm>
+#include <utility>
+
+CommandSequence::CommandSequence()
+    : CommandSequence(ChantBook::getDefault()) {}
+
+CommandSequence::CommandSequence(std::shared_ptr<const ChantBook> chants)
+    : m_chants(std::move(chants)), m_state(0), m_history(0), m_size(0) {
+    if (!m_chants) {
+        throw InvalidStateException("Command sequence needs a chant book");
+    }
 }
 
-bool CommandSequence::matchesMove() const { 
-    return endsWithPattern({ "pa", "pa", "pa", "po" }); 
+void CommandSequence::push(Drum drum) {
+    m_state = m_chants->advance(m_state, drum);
+    m_history = (m_history << 1) | static_cast<std::uint32_t>(drum);
+    m_size = std::min(m_size + 1, m_chants->getMaxLength());
 }
 
-bool CommandSequence::matchesAttack() const { 
-    return endsWithPattern({ "po", "po", "pa", "po" }); 
+void CommandSequence::clear() {
+    m_state = 0;
+    m_history = 0;
+    m_size = 0;
 }
 
-bool CommandSequence::matchesRetreat() const {
-    return endsWithPattern({ "po", "pa", "po", "pa" });
+Drum CommandSequence::operator[](std::size_t index) const {
+    return static_cast<Drum>((m_history >> (m_size - 1 - index)) & 1u);
 }
-
-void CommandSequence::clear() { m_seq.clear(); }
-
-const std::vector<std::string>& CommandSequence::getCommands() const { return m_seq; }
-
-bool CommandSequence::endsWithPattern(const std::vector<std::string> &pattern) const {
-    if (m_seq.size() < pattern.size()) return false;
-    size_t n = m_seq.size(), m = pattern.size();
-    for (size_t i = 0; i < m; ++i)
-        if (m_seq[n - m + i] != pattern[i]) return false;
-    return true;
-}
-
-
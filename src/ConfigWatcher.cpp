@@ -0,0 +1,169 @@
+#include "ConfigWatcher.h"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    // Editors often write a file in several steps; let them finish first.
+    constexpr std::chrono::milliseconds SETTLE_TIME{50};
+}
+
+ConfigWatcher::ConfigWatcher(std::string filename, std::chrono::milliseconds pollInterval)
+    : m_filename(std::move(filename)),
+      m_name(std::filesystem::path(m_filename).filename().string()),
+      m_pollInterval(pollInterval),
+      m_config(GameConfig::load(m_filename)),
+      m_stamp(readStamp()) {
+    validate(*m_config);
+#ifdef __linux__
+    m_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_inotify >= 0) {
+        const std::filesystem::path parent = std::filesystem::path(m_filename).parent_path();
+        const std::string directory = parent.empty() ? std::string(".") : parent.string();
+        if (inotify_add_watch(m_inotify, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0) {
+            close(m_inotify);
+            m_inotify = -1;
+        }
+    }
+#endif
+    m_watcher = std::thread(&ConfigWatcher::watchLoop, this);
+}
+
+ConfigWatcher::~ConfigWatcher() {
+    stop();
+#ifdef __linux__
+    if (m_inotify >= 0) {
+        close(m_inotify);
+    }
+#endif
+}
+
+void ConfigWatcher::stop() {
+    m_stopping.store(true, std::memory_order_release);
+    if (m_watcher.joinable()) {
+        m_watcher.join();
+    }
+}
+
+std::shared_ptr<const GameConfig> ConfigWatcher::getConfig() const {
+    std::lock_guard lock(m_mutex);
+    return m_config;
+}
+
+std::string ConfigWatcher::getLastError() const {
+    std::lock_guard lock(m_mutex);
+    return m_lastError;
+}
+
+void ConfigWatcher::watchLoop() {
+    while (!m_stopping.load(std::memory_order_acquire)) {
+        if (waitForChange()) {
+            reload();
+        }
+    }
+}
+
+bool ConfigWatcher::waitForChange() {
+    if (m_inotify >= 0) {
+        return waitForEvent();
+    }
+    std::this_thread::sleep_for(m_pollInterval);
+    const Stamp stamp = readStamp();
+    if (stamp == m_stamp) return false;
+    std::this_thread::sleep_for(SETTLE_TIME);
+    m_stamp = readStamp();
+    return true;
+}
+
+bool ConfigWatcher::waitForEvent() {
+#ifdef __linux__
+    pollfd descriptor{m_inotify, POLLIN, 0};
+    if (poll(&descriptor, 1, static_cast<int>(m_pollInterval.count())) <= 0) return false;
+
+    bool changed = false;
+    bool settled = false;
+    alignas(inotify_event) char buffer[4096];
+    while (true) {
+        const ssize_t length = read(m_inotify, buffer, sizeof(buffer));
+        if (length <= 0) {
+            if (!changed || settled) break;
+            std::this_thread::sleep_for(SETTLE_TIME);
+            settled = true;
+            continue;
+        }
+        for (ssize_t offset = 0; offset < length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            if (event->len > 0 && m_name == event->name) {
+                changed = true;
+            }
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+        }
+    }
+    return changed;
+#else
+    return false;
+#endif
+}
+
+ConfigWatcher::Stamp ConfigWatcher::readStamp() const {
+    std::error_code error;
+    Stamp stamp;
+    stamp.modified = std::filesystem::last_write_time(m_filename, error);
+    stamp.size = std::filesystem::file_size(m_filename, error);
+    return stamp;
+}
+
+std::string ConfigWatcher::readFile() const {
+    std::ifstream file(m_filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw ResourceLoadException("Failed to open config file: " + m_filename);
+    }
+    std::ostringstream text;
+    text << file.rdbuf();
+    if (file.bad()) {
+        throw ResourceLoadException("Failed to read config file: " + m_filename);
+    }
+    return std::move(text).str();
+}
+
+void ConfigWatcher::reload() {
+    try {
+        const std::string text = readFile();
+        auto config = std::make_shared<const GameConfig>(getConfig()->reparse(text));
+        validate(*config);
+        std::lock_guard lock(m_mutex);
+        m_config = std::move(config);
+        m_lastError.clear();
+        m_reloads.fetch_add(1, std::memory_order_relaxed);
+    } catch (const GameException& e) {
+        recordFailure(e.what());
+    } catch (const std::exception& e) {
+        // A rename or delete racing the read, or running out of memory, must
+        // not escape the watcher thread and terminate the game.
+        std::cerr << "Config reload failed: " << e.what() << std::endl;
+        recordFailure(e.what());
+    }
+}
+
+void ConfigWatcher::recordFailure(const std::string& error) {
+    std::lock_guard lock(m_mutex);
+    m_lastError = error;
+    m_failures.fetch_add(1, std::memory_order_relaxed);
+}
+
+// The menu lets the player pick any type, so a config missing one could
+// never start a battle.
+void ConfigWatcher::validate(const GameConfig& config) {
+    for (const PataponType type : {PataponType::SPEAR, PataponType::SHIELD, PataponType::BOW}) {
+        if (config.findSoldier(type) == nullptr) {
+            throw InvalidInputException("Config must define a SPEAR, SHIELD and BOW soldier");
+        }
+    }
+}
@@ -0,0 +1,70 @@
+#include "DrumPolicy.h"
+#include "GameException.h"
+#include <utility>
+
+void DrumPolicy::fill(std::span<Drum> drums) {
+    for (Drum& drum : drums) {
+        drum = nextDrum();
+    }
+}
+
+ScriptedPolicy::ScriptedPolicy(std::vector<Drum> script)
+    : m_script(std::move(script)), m_next(0) {
+    if (m_script.empty()) {
+        throw InvalidInputException("Drum script cannot be empty");
+    }
+}
+
+std::unique_ptr<DrumPolicy> ScriptedPolicy::clone() const {
+    return std::make_unique<ScriptedPolicy>(*this);
+}
+
+void ScriptedPolicy::reset(std::uint64_t) {
+    m_next = 0;
+}
+
+Drum ScriptedPolicy::nextDrum() {
+    const Drum drum = m_script[m_next];
+    m_next = (m_next + 1) % m_script.size();
+    return drum;
+}
+
+void ScriptedPolicy::fill(std::span<Drum> drums) {
+    for (Drum& drum : drums) {
+        drum = m_script[m_next];
+        m_next = m_next + 1 == m_script.size() ? 0 : m_next + 1;
+    }
+}
+
+RandomChantPolicy::RandomChantPolicy(std::shared_ptr<const ChantBook> chants)
+    : m_chants(std::move(chants)), m_random(0), m_chant(0), m_beat(0) {
+    if (!m_chants) {
+        throw InvalidStateException("Random chant policy needs a chant book");
+    }
+}
+
+std::unique_ptr<DrumPolicy> RandomChantPolicy::clone() const {
+    return std::make_unique<RandomChantPolicy>(*this);
+}
+
+void RandomChantPolicy::reset(std::uint64_t seed) {
+    m_random = Random(~seed);
+    m_beat = 0;
+}
+
+Drum RandomChantPolicy::nextDrum() {
+    const auto& entries = m_chants->getEntries();
+    if (m_beat == 0) {
+        m_chant = static_cast<std::size_t>(m_random.nextBelow(static_cast<int>(entries.size())));
+    }
+    const std::vector<Drum>& drums = entries[m_chant].drums;
+    const Drum drum = drums[m_beat];
+    m_beat = (m_beat + 1) % drums.size();
+    return drum;
+}
+
+void RandomChantPolicy::fill(std::span<Drum> drums) {
+    for (Drum& drum : drums) {
+        drum = RandomChantPolicy::nextDrum();
+    }
+}
@@ -1,4 +1,5 @@
 #include "Enemy.h"
+#include "TileIndex.h"
 #include <algorithm>
 #include <utility>
 
@@ -13,6 +14,8 @@ Enemy::Enemy(std::string name, int hp, int atk, int pos)
 }
 
 
+Enemy::Enemy(const Enemy& other)
+    : Unit(other), m_pos(other.m_pos) {}
 
 std::unique_ptr<Unit> Enemy::clone() const {
     return std::make_unique<Enemy>(*this);
@@ -25,7 +28,12 @@ int Enemy::dealDamage() const {
 
 
 int Enemy::getPos() const { return m_pos; }
-void Enemy::setPos(int p) { m_pos = p; }
+void Enemy::setPos(int p) {
+    if (m_tiles) {
+        m_tiles->move(*this, m_pos, p);
+    }
+    m_pos = p;
+}
 
 
 
@@ -0,0 +1,26 @@
+#include "EntityId.h"
+#include "GameException.h"
+
+EntityId EntityIdAllocator::allocate() {
+    if (!m_free.empty()) {
+        const std::uint32_t index = m_free.back();
+        m_free.pop_back();
+        m_alive[index] = true;
+        return {index, m_generations[index]};
+    }
+    if (m_generations.size() == EntityId::INVALID_INDEX) {
+        throw InvalidStateException("Entity id space exhausted");
+    }
+    m_generations.push_back(0);
+    m_alive.push_back(true);
+    return {static_cast<std::uint32_t>(m_generations.size() - 1), 0};
+}
+
+void EntityIdAllocator::release(EntityId id) {
+    if (!isAlive(id)) {
+        throw InvalidStateException("Releasing an entity id that is not alive");
+    }
+    m_alive[id.index] = false;
+    ++m_generations[id.index];
+    m_free.push_back(id.index);
+}
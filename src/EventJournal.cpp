@@ -0,0 +1,67 @@
+#include "EventJournal.h"
+#include "GameException.h"
+#include <chrono>
+#include <cstring>
+
+EventJournal::EventJournal(const std::string& filename, Overflow overflow)
+    : m_file(filename, std::ios::binary | std::ios::trunc), m_overflow(overflow) {
+    if (!m_file.is_open()) {
+        throw ResourceLoadException("Failed to open event journal: " + filename);
+    }
+    m_file.write(MAGIC, sizeof(MAGIC));
+    m_writer = std::thread(&EventJournal::writerLoop, this);
+}
+
+EventJournal::~EventJournal() {
+    close();
+}
+
+void EventJournal::close() {
+    m_stopping.store(true, std::memory_order_release);
+    if (m_writer.joinable()) {
+        m_writer.join();
+    }
+}
+
+bool EventJournal::push(const CombatEvent& event) noexcept {
+    while (!m_ring.push(event)) {
+        if (m_overflow == Overflow::DROP) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+void EventJournal::writerLoop() {
+    while (!m_stopping.load(std::memory_order_acquire)) {
+        if (!drain()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    drain();
+    m_file.flush();
+}
+
+bool EventJournal::drain() {
+    std::uint64_t count = 0;
+    CombatEvent event{};
+    while (m_ring.pop(event)) {
+        write(event);
+        ++count;
+    }
+    m_written.fetch_add(count, std::memory_order_relaxed);
+    return count > 0;
+}
+
+void EventJournal::write(const CombatEvent& event) {
+    char record[17];
+    const auto kind = static_cast<std::uint8_t>(event.kind);
+    std::memcpy(record, &event.turn, 4);
+    std::memcpy(record + 4, &kind, 1);
+    std::memcpy(record + 5, &event.actor, 4);
+    std::memcpy(record + 9, &event.target, 4);
+    std::memcpy(record + 13, &event.amount, 4);
+    m_file.write(record, sizeof(record));
+}
@@ -0,0 +1,75 @@
+#include "EventLog.h"
+#include "Army.h"
+#include "EventJournal.h"
+#include "Scenario.h"
+
+std::int32_t CombatEvent::enemy(const Enemy& enemy) {
+    return enemy.isBoss() ? BOSS : BEAST;
+}
+
+void EventLog::beginTurn(int turn) {
+    m_turn = turn;
+    m_start = 0;
+    m_size = 0;
+}
+
+void EventLog::push(CombatEventKind kind, std::int32_t actor, std::int32_t target, std::int32_t amount) {
+    const CombatEvent event{m_turn, kind, actor, target, amount};
+    if (m_size < CAPACITY) {
+        m_events[(m_start + m_size) % CAPACITY] = event;
+        ++m_size;
+    } else {
+        m_events[m_start] = event;
+        m_start = (m_start + 1) % CAPACITY;
+    }
+    if (m_journal) {
+        m_journal->push(event);
+    }
+}
+
+std::string EventLog::describe(const CombatEvent& event, const Army& army, const Scenario& scenario) {
+    auto enemyName = [&scenario](std::int32_t id) -> const std::string& {
+        return id == CombatEvent::BOSS ? scenario.getBoss().getName() : scenario.getBeast().getName();
+    };
+    auto soldierName = [&army](std::int32_t id) -> const std::string& {
+        return army.getSoldier(static_cast<std::size_t>(id)).getName();
+    };
+
+    switch (event.kind) {
+        case CombatEventKind::BEAST_APPEARED:
+            return "A APARUT O BESTIE!";
+        case CombatEventKind::BOSS_APPEARED:
+            return "GENERALUL ZIGOTON A APARUT!";
+        case CombatEventKind::MOVE_BLOCKED:
+            return "MISCARE BLOCATA DE INAMIC!";
+        case CombatEventKind::FIELD_CLEARED:
+            return "TOTI INAMICII AU FOST INVINSI! ARMATA INAINTEAZA MAI RAPID!";
+        case CombatEventKind::ARMY_ADVANCED:
+            return "ARMATA A INAINTAT!";
+        case CombatEventKind::RETREAT_BLOCKED:
+            return "NU POTI MERGE MAI IN SPATE!";
+        case CombatEventKind::ARMY_RETREATED:
+            return "ARMATA S-A RETRAS!";
+        case CombatEventKind::ARMY_ATTACKS:
+            return "ARMATA ATACA!";
+        case CombatEventKind::ENEMY_HIT:
+            return "Armata a atacat " + enemyName(event.target) + " iar acesta a pierdut " + std::to_string(event.amount) + " HP!";
+        case CombatEventKind::ENEMY_DEFEATED:
+            return enemyName(event.target) + " a fost invins!";
+        case CombatEventKind::COUNTERATTACK:
+            return enemyName(event.actor) + " a contraatacat " + soldierName(event.target) + " iar acesta a pierdut " + std::to_string(event.amount) + " HP!";
+        case CombatEventKind::SOLDIER_HIT:
+            return enemyName(event.actor) + " a atacat " + soldierName(event.target) + " iar acesta a pierdut " + std::to_string(event.amount) + " HP!";
+        case CombatEventKind::SOLDIER_DEFEATED:
+            return soldierName(event.target) + " a fost invins!";
+        case CombatEventKind::ENEMY_FELL:
+            return event.target == CombatEvent::BOSS ? scenario.getBoss().getDeathMessage() : scenario.getBeast().getDeathMessage();
+        case CombatEventKind::BOSS_MISSED:
+            return "GENERALUL ZIGOTON A RATAT ATACUL!";
+        case CombatEventKind::BOSS_GATHERING:
+            return "GENERALUL ZIGOTON ISI ADUNA PUTERILE!";
+        case CombatEventKind::BOSS_PREPARING:
+            return "GENERALUL ZIGOTON PREGATESTE UN ATAC PUTERNIC!";
+    }
+    return {};
+}
@@ -0,0 +1,99 @@
+#include "FrameProfiler.h"
+#include "GameException.h"
+#include <algorithm>
+
+namespace {
+    float toMs(FrameProfiler::Clock::duration duration) {
+        return std::chrono::duration<float, std::milli>(duration).count();
+    }
+}
+
+FrameProfiler::FrameProfiler()
+    : m_origin(Clock::now()),
+      m_frameStart(m_origin) {
+}
+
+FrameProfiler::~FrameProfiler() {
+    stopTrace();
+}
+
+void FrameProfiler::beginFrame() {
+    m_frameStart = Clock::now();
+    std::ranges::fill(m_frameSectionMs, 0.0f);
+}
+
+void FrameProfiler::endFrame() {
+    const Clock::time_point end = Clock::now();
+    m_frameMs[m_historyNext] = toMs(end - m_frameStart);
+    m_historyNext = (m_historyNext + 1) % HISTORY;
+
+    for (std::size_t i = 0; i < m_sections.size(); ++i) {
+        Section& section = m_sections[i];
+        section.lastMs = m_frameSectionMs[i];
+        section.averageMs += (section.lastMs - section.averageMs) * SMOOTHING;
+    }
+    writeTraceEvent("frame", m_frameStart, end);
+}
+
+void FrameProfiler::startTrace(const std::string& filename) {
+    stopTrace();
+    m_trace.open(filename, std::ios::trunc);
+    if (!m_trace.is_open()) {
+        throw ResourceLoadException("Failed to open trace file: " + filename);
+    }
+    m_trace << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    m_firstTraceEvent = true;
+}
+
+void FrameProfiler::stopTrace() {
+    if (!m_trace.is_open()) return;
+    m_trace << "\n]}\n";
+    m_trace.close();
+}
+
+std::size_t FrameProfiler::open(const char* name) {
+    const auto found = std::ranges::find(m_sections, name, &Section::name);
+    if (found != m_sections.end()) {
+        return static_cast<std::size_t>(found - m_sections.begin());
+    }
+    m_sections.push_back({name, m_depth, 0.0f, 0.0f});
+    m_frameSectionMs.push_back(0.0f);
+    return m_sections.size() - 1;
+}
+
+void FrameProfiler::record(std::size_t section, Clock::time_point start, Clock::time_point end) {
+    m_frameSectionMs[section] += toMs(end - start);
+    writeTraceEvent(m_sections[section].name, start, end);
+}
+
+void FrameProfiler::writeTraceEvent(const char* name, Clock::time_point start, Clock::time_point end) {
+    if (!m_trace.is_open()) return;
+    const auto us = [this](Clock::time_point at) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(at - m_origin).count();
+    };
+    m_trace << (m_firstTraceEvent ? "" : ",\n")
+            << "{\"name\":\"" << name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" << us(start)
+            << ",\"dur\":" << us(end) - us(start) << '}';
+    m_firstTraceEvent = false;
+}
+
+ProfileScope::ProfileScope(FrameProfiler& profiler, const char* name)
+    : m_profiler(profiler),
+      m_section(profiler.open(name)),
+      m_start(FrameProfiler::Clock::now()) {
+    ++m_profiler.m_depth;
+}
+
+ProfileScope::~ProfileScope() {
+    --m_profiler.m_depth;
+    m_profiler.record(m_section, m_start, FrameProfiler::Clock::now());
+}
+
+void ProfileScope::next(const char* name) {
+    const FrameProfiler::Clock::time_point now = FrameProfiler::Clock::now();
+    m_profiler.record(m_section, m_start, now);
+    --m_profiler.m_depth;
+    m_section = m_profiler.open(name);
+    ++m_profiler.m_depth;
+    m_start = now;
+}
@@ -5,19 +5,27 @@
 #include <cctype>
 #include <cmath>
 
-Game::Game(const Army& army, std::vector<std::unique_ptr<Enemy>> enemies)
-    : m_army(army), m_enemies(std::move(enemies)), m_won(false), m_lost(false), m_turns(0) {
-    m_goal = GameConstants::MAP_SIZE - 1;
+Game::Game(const Army& army, std::vector<std::unique_ptr<Enemy>> enemies, std::uint64_t seed, Scenario scenario)
+    : m_army(army), m_enemies(std::move(enemies)), m_random(seed), m_scenario(std::move(scenario)), m_tiles(m_scenario.getLayout().length), m_won(false), m_lost(false), m_turns(0) {
+    m_goal = m_scenario.getGoal();
+    m_commands = CommandSequence(m_scenario.getChants());
+    m_stats.setSeed(seed);
+    std::vector<std::unique_ptr<Enemy>> initialEnemies;
+    initialEnemies.swap(m_enemies);
+    for (auto& e : initialEnemies) {
+        addEnemy(std::move(e));
+    }
 }
 
 void Game::update() {
     if (m_won || m_lost || m_bossEventActive || m_victoryMarchActive) return;
 
-    if (m_beastsSpawned < 3) {
-        if (m_enemies.empty() && m_army.getPosition() < m_goal - 5) {
+    const int waves = m_scenario.getLayout().waves;
+    if (m_beastsSpawned < waves) {
+        if (m_enemies.empty() && m_army.getPosition() < m_scenario.getWaveSpawn(m_beastsSpawned)) {
              spawnBeast();
         }
-    } else if (m_beastsDefeated >= 3 && !m_bossSpawned && !m_bossEventActive) {
+    } else if (m_beastsDefeated >= waves && !m_bossSpawned && !m_bossEventActive) {
         if (m_enemies.empty()) {
             m_bossEventActive = true; 
         }
@@ -34,26 +42,32 @@ void Game::update() {
 
 void Game::processTurn() {
     if (m_won || m_lost || m_bossEventActive || m_victoryMarchActive) return;
-    m_log.clear();
+    m_events.beginTurn(m_turns + 1);
 
-    if (m_beastsSpawned < 3) {
-        if (rand() % 100 < 10 && m_enemies.size() < 2) {
+    if (m_beastsSpawned < m_scenario.getLayout().waves) {
+        if (m_random.nextBelow(100) < 10 && m_enemies.size() < 2) {
              spawnBeast();
         }
     }
 
-    if (m_commands.matchesMove()) {
-        m_stats.addCommand();
-        handleMove();
-        m_commands.clear();
-    } else if (m_commands.matchesRetreat()) {
-        m_stats.addCommand();
-        handleRetreat();
-        m_commands.clear();
-    } else if (m_commands.matchesAttack()) {
-        m_stats.addCommand();
-        handleAttack();
-        m_commands.clear();
+    switch (m_commands.match()) {
+        case Chant::MOVE:
+            m_stats.addCommand();
+            handleMove();
+            m_commands.clear();
+            break;
+        case Chant::RETREAT:
+            m_stats.addCommand();
+            handleRetreat();
+            m_commands.clear();
+            break;
+        case Chant::ATTACK:
+            m_stats.addCommand();
+            handleAttack();
+            m_commands.clear();
+            break;
+        case Chant::NONE:
+            break;
     }
     
     cleanupDeadEnemies();
@@ -71,22 +85,16 @@ void Game::processTurn() {
 
 
 void Game::spawnBeast() {
-    int spawnPos = m_goal - 5;
-    if (spawnPos >= GameConstants::MAP_SIZE) spawnPos = GameConstants::MAP_SIZE - 1;
-    
-    m_enemies.push_back(std::make_unique<Enemy>("Bestia", 20, 2, spawnPos)); 
+    addEnemy(m_scenario.makeBeast(m_scenario.getWaveSpawn(m_beastsSpawned)));
     m_beastsSpawned++;
-    m_log.emplace_back("A APARUT O BESTIE!");
+    m_events.push(CombatEventKind::BEAST_APPEARED);
 }
 
 void Game::spawnBoss() {
     if (m_bossSpawned) return;
-    int spawnPos = m_goal - 5;
-    if (spawnPos >= GameConstants::MAP_SIZE) spawnPos = GameConstants::MAP_SIZE - 1;
-    
-    m_enemies.push_back(std::make_unique<Boss>("Zigoton General", 50, 2, spawnPos, 3));
+    addEnemy(m_scenario.makeBoss(m_scenario.getBossSpawn()));
     m_bossSpawned = true;
-    m_log.emplace_back("GENERALUL ZIGOTON A APARUT!");
+    m_events.push(CombatEventKind::BOSS_APPEARED);
 }
 
 
@@ -105,25 +113,18 @@ void Game::handleMove() {
     if (target > m_goal) {
         target = m_goal;
     }
-    
-    if (target >= GameConstants::MAP_SIZE) {
-        target = GameConstants::MAP_SIZE - 1;
-    }
 
     for (int pos = m_army.getPosition() + 1; pos <= target; ++pos) {
-        for (const auto& e : m_enemies) {
-            if (!e->isAlive()) continue;
-            if (e->getPos() == pos) {
-                m_log.emplace_back("MISCARE BLOCATA DE INAMIC!");
-                return;
-            }
+        if (m_tiles.hasLiving(pos)) {
+            m_events.push(CombatEventKind::MOVE_BLOCKED);
+            return;
         }
     }
 
     if (allEnemiesDead) {
-        m_log.emplace_back("TOTI INAMICII AU FOST INVINSI! ARMATA INAINTEAZA MAI RAPID!");
+        m_events.push(CombatEventKind::FIELD_CLEARED);
     }
-    m_log.emplace_back("ARMATA A INAINTAT!");
+    m_events.push(CombatEventKind::ARMY_ADVANCED);
     m_stats.addSteps(moveDistance);
     m_army.moveForward(moveDistance);
 }
@@ -133,75 +134,94 @@ void Game::handleRetreat() {
     int target = currentPos - 1;
 
     if (target < 0) {
-        m_log.emplace_back("NU POTI MERGE MAI IN SPATE!");
+        m_events.push(CombatEventKind::RETREAT_BLOCKED);
         return;
     }
 
-    m_log.emplace_back("ARMATA S-A RETRAS!");
+    m_events.push(CombatEventKind::ARMY_RETREATED);
     m_stats.addSteps(1);
     m_army.moveBackward(1);
 }
 
 void Game::handleAttack() {
-    m_log.emplace_back("ARMATA ATACA!");
-    m_army.attackEnemies(m_enemies, m_log, m_stats);
+    m_events.push(CombatEventKind::ARMY_ATTACKS);
+    m_army.attackEnemies(m_tiles, m_events, m_stats);
     m_attackTriggered = true;
 }
 
+void Game::addEnemy(std::unique_ptr<Enemy> enemy) {
+    enemy->setId(m_entityIds.allocate());
+    m_tiles.insert(*enemy);
+    if (auto* boss = dynamic_cast<Boss*>(enemy.get())) {
+        m_bosses.push_back(boss);
+    }
+    m_enemies.push_back(std::move(enemy));
+}
+
 void Game::cleanupDeadEnemies() {
     std::erase_if(m_enemies, [this](const std::unique_ptr<Enemy>& e) { 
         if (!e->isAlive()) {
-             m_log.emplace_back(e->getDeathMessage());
+             m_events.push(CombatEventKind::ENEMY_FELL, CombatEvent::NONE, CombatEvent::enemy(*e));
              if (!e->isBoss()) {
                  m_beastsDefeated++;
+             } else {
+                 std::erase(m_bosses, static_cast<Boss*>(e.get()));
              }
+             m_tiles.remove(*e);
+             m_entityIds.release(e->getId());
              return true;
         }
         return false;
     });
 }
 
+// Bosses act every turn, since a charge builds up even out of reach. Beasts
+// only act within range, so only the tiles around the army are visited.
 void Game::enemiesAttack() {
     const int enemyAttackRange = 1;
 
-    for (const auto& e : m_enemies) {
-        if (!e->isAlive()) continue;
+    for (Boss* boss : m_bosses) {
+        if (boss->isAlive()) {
+            bossAttack(*boss, enemyAttackRange);
+        }
+    }
 
-        Boss* boss = dynamic_cast<Boss*>(e.get());
-        if (boss) {
-            if (boss->isCharging()) {
-                if (boss->getChargeTurns() >= 1) {
-                    boss->resetCharge();
-                    int dist = std::abs(boss->getPos() - m_army.getPosition());
-                    if (dist <= enemyAttackRange) {
-                         int dmg = boss->dealDamage() * 2; 
-                         m_army.receiveEnemyAttack(dmg, boss->getName(), m_log, m_stats);
-                    } else {
-                         m_log.emplace_back("GENERALUL ZIGOTON A RATAT ATACUL!");
-                    }
-                } else {
-                    boss->incrementChargeTurns();
-                    m_log.emplace_back("GENERALUL ZIGOTON ISI ADUNA PUTERILE!");
-                }
+    const int armyPos = m_army.getPosition();
+    for (int tile = armyPos - enemyAttackRange; tile <= armyPos + enemyAttackRange; ++tile) {
+        m_tiles.forEach(tile, [this](Enemy& e) {
+            if (!e.isAlive() || e.isBoss()) return;
+            int dmg = e.dealDamage();
+            m_army.receiveEnemyAttack(dmg, e, m_events, m_stats);
+        });
+    }
+}
+
+void Game::bossAttack(Boss& boss, int range) {
+    if (boss.isCharging()) {
+        if (boss.getChargeTurns() >= 1) {
+            boss.resetCharge();
+            int dist = std::abs(boss.getPos() - m_army.getPosition());
+            if (dist <= range) {
+                 int dmg = boss.dealDamage() * 2; 
+                 m_army.receiveEnemyAttack(dmg, boss, m_events, m_stats);
             } else {
-                int dist = std::abs(boss->getPos() - m_army.getPosition());
-                if (dist <= enemyAttackRange) {
-                    if (boss->getAttackCount() % 2 == 1) {
-                         boss->startCharge();
-                         m_log.emplace_back("GENERALUL ZIGOTON PREGATESTE UN ATAC PUTERNIC!");
-                         boss->incrementAttackCount();
-                    } else {
-                         int dmg = boss->dealDamage();
-                         m_army.receiveEnemyAttack(dmg, boss->getName(), m_log, m_stats);
-                         boss->incrementAttackCount();
-                    }
-                }
+                 m_events.push(CombatEventKind::BOSS_MISSED, CombatEvent::BOSS);
             }
         } else {
-            int dist = std::abs(e->getPos() - m_army.getPosition());
-            if (dist <= enemyAttackRange) {
-                int dmg = e->dealDamage();
-                m_army.receiveEnemyAttack(dmg, e->getName(), m_log, m_stats);
+            boss.incrementChargeTurns();
+            m_events.push(CombatEventKind::BOSS_GATHERING, CombatEvent::BOSS);
+        }
+    } else {
+        int dist = std::abs(boss.getPos() - m_army.getPosition());
+        if (dist <= range) {
+            if (boss.getAttackCount() % 2 == 1) {
+                 boss.startCharge();
+                 m_events.push(CombatEventKind::BOSS_PREPARING, CombatEvent::BOSS);
+                 boss.incrementAttackCount();
+            } else {
+                 int dmg = boss.dealDamage();
+                 m_army.receiveEnemyAttack(dmg, boss, m_events, m_stats);
+                 boss.incrementAttackCount();
             }
         }
     }
@@ -214,13 +234,13 @@ void Game::enemiesAdvance() {
         if (e->getPos() > armyPos) {
             int desired = e->getPos() - 1;
             if (desired <= armyPos) continue;
-            if (desired >= 0 && desired < GameConstants::MAP_SIZE) {
+            if (m_tiles.contains(desired)) {
                 e->setPos(desired);
             }
         } else if (e->getPos() < armyPos) {
             int desired = e->getPos() + 1;
             if (desired >= armyPos) continue;
-            if (desired >= 0 && desired < GameConstants::MAP_SIZE) {
+            if (m_tiles.contains(desired)) {
                 e->setPos(desired);
             }
         }
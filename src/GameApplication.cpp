@@ -1,44 +1,101 @@
 #include "GameApplication.h"
 #include "GameException.h"
 #include "GameConfig.h"
-#include "Boss.h"
 #include <sstream>
 #include <iostream>
 #include <cmath>
 #include <algorithm>
-#include <set>
+#include <random>
+
+namespace {
+    enum HudSlot : std::size_t {
+        ARMY_TYPE_SLOT,
+        ARMY_COUNT_SLOT,
+        SEQUENCE_SLOT,
+        LAST_LOG_SLOT,
+        BOSSFIGHT_SLOT,
+        STATS_TITLE_SLOT,
+        STATS_BODY_SLOT,
+        STATS_BACK_SLOT,
+        STATS_PROMPT_SLOT,
+        RESULT_TITLE_SLOT,
+        RESULT_RETRY_SLOT,
+        MENU_TITLE_SLOT,
+        MENU_HELP_SLOT,
+        LATENCY_SLOT,
+        PROFILER_SLOT,
+        CONFIG_SLOT,
+        MENU_SLOT_LABELS,
+        ENEMY_LABEL_SLOTS = MENU_SLOT_LABELS + 6
+    };
+
+    PataponType toPataponType(UnitType type) {
+        switch (type) {
+            case UnitType::YARIPON: return PataponType::SPEAR;
+            case UnitType::TATEPON: return PataponType::SHIELD;
+            case UnitType::YUMIPON: return PataponType::BOW;
+        }
+        return PataponType::SPEAR;
+    }
+
+    const char* drumLabel(Drum drum) {
+        return drum == Drum::PATA ? "PATA" : "PON";
+    }
+
+    std::string chantLabel(const ChantBook& chants, Chant chant) {
+        const std::vector<Drum>* drums = chants.find(chant);
+        if (!drums) return "-";
+
+        std::string label;
+        for (Drum drum : *drums) {
+            if (!label.empty()) label += " ";
+            label += drumLabel(drum);
+        }
+        return label;
+    }
+}
 
-GameApplication::GameApplication() 
+GameApplication::GameApplication(bool prewarmGlyphs) 
     : m_window(sf::VideoMode({static_cast<unsigned>(WINDOW_WIDTH), static_cast<unsigned>(WINDOW_HEIGHT)}), "PROTOPON"),
+      m_prewarmGlyphs(prewarmGlyphs),
       m_pataSprite(m_pataTexture),
       m_ponSprite(m_ponTexture),
-      m_pataSound(m_pataBuffer),
-      m_ponSound(m_ponBuffer),
-      m_state(GameState::MENU),
+      m_texts(m_font),
+      m_camera(sf::FloatRect({0, 0}, {WINDOW_WIDTH, WINDOW_HEIGHT})),
+      m_state(GameState::LOADING),
       m_selectedUnits({UnitType::YUMIPON, UnitType::YARIPON, UnitType::TATEPON})
 {
     m_window.setFramerateLimit(60);
+    m_configWatcher = std::make_unique<ConfigWatcher>("assets/game_config.txt");
+    m_config = m_configWatcher->getConfig();
+
+    m_assets = std::make_unique<AssetLoader>();
+    m_assets->addSound("assets/pata-drum.mp3", m_pataBuffer);
+    m_assets->addSound("assets/pon-drum.mp3", m_ponBuffer);
+    m_assets->addFont({"assets/pata_font.ttf", "C:/Windows/Fonts/arial.ttf"}, m_font);
+    m_assets->addTexture("assets/pata.png", m_pataTexture);
+    m_assets->addTexture("assets/pon.png", m_ponTexture);
+    m_assets->addTexture("assets/yaripon.png", m_yariponTexture);
+    m_assets->addTexture("assets/tatepon.png", m_tateponTexture);
+    m_assets->addTexture("assets/yumipon.png", m_yumiponTexture);
+    m_assets->addImage("assets/icon.png", m_icon, false);
+}
 
-    sf::Image icon;
-    if (icon.loadFromFile("assets/icon.png")) {
-        m_window.setIcon(icon.getSize(), icon.getPixelsPtr());
-    }
+// Runs on the window thread once every asset has arrived.
+void GameApplication::finishLoading() {
+    m_assetTimings = m_assets->getTimings();
+    m_loadTime = m_assets->getElapsed();
+    m_assets.reset();
 
-    if (!m_font.openFromFile("assets/pata_font.ttf")) {
-        if (!m_font.openFromFile("C:/Windows/Fonts/arial.ttf")) {
-            throw ResourceLoadException("Failed to load font: assets/pata_font.ttf or C:/Windows/Fonts/arial.ttf");
-        }
+    if (m_icon.getSize().x > 0) {
+        m_window.setIcon(m_icon.getSize(), m_icon.getPixelsPtr());
+    }
+    if (m_prewarmGlyphs) {
+        m_texts.prewarm({100, 80, 60, 50, 30, 24, 20, 16, 14});
     }
 
-    if (!m_pataTexture.loadFromFile("assets/pata.png")) throw ResourceLoadException("assets/pata.png");
-    if (!m_ponTexture.loadFromFile("assets/pon.png")) throw ResourceLoadException("assets/pon.png");
-    if (!m_yariponTexture.loadFromFile("assets/yaripon.png")) throw ResourceLoadException("assets/yaripon.png");
-    if (!m_tateponTexture.loadFromFile("assets/tatepon.png")) throw ResourceLoadException("assets/tatepon.png");
-    if (!m_yumiponTexture.loadFromFile("assets/yumipon.png")) throw ResourceLoadException("assets/yumipon.png");
-
-    if (!m_pataBuffer.loadFromFile("assets/pata-drum.mp3")) throw ResourceLoadException("assets/pata-drum.mp3");
-    if (!m_ponBuffer.loadFromFile("assets/pon-drum.mp3")) throw ResourceLoadException("assets/pon-drum.mp3");
-
+    m_pataVoices = std::make_unique<VoicePool>(m_pataBuffer);
+    m_ponVoices = std::make_unique<VoicePool>(m_ponBuffer);
 
     m_pataponIcons = {&m_tateponTexture, &m_yariponTexture, &m_yumiponTexture};
 
@@ -50,32 +107,72 @@ GameApplication::GameApplication()
     m_ponSprite.setOrigin(sf::Vector2f(m_ponTexture.getSize()) / 2.0f);
     m_ponSprite.setPosition({WINDOW_WIDTH - 80, BATTLEFIELD_HEIGHT / 2});
 
-    std::vector<std::unique_ptr<Patapon>> soldiers = GameConfig::loadSoldiers("assets/game_config.txt");
-    std::vector<std::unique_ptr<Enemy>> initialEnemies;
-    m_game = std::make_unique<Game>(Army(std::move(soldiers), 0), std::move(initialEnemies));
-    
-    m_armyPos = AnimatedPosition();
-    m_armyPos.snapTo(posToX(m_game->getArmy().getPosition()), m_fieldY);
-    m_enemyPositions.clear();
-    for (const auto& e : m_game->getEnemies()) {
-        AnimatedPosition pos;
-        pos.snapTo(posToX(e->getPos()), m_fieldY);
-        m_enemyPositions[e.get()] = pos;
-    }
+    m_state = GameState::MENU;
 }
 
 float GameApplication::posToX(int pos) const {
-    return m_fieldLeft + (static_cast<float>(pos) / (GameConstants::MAP_SIZE - 1)) * m_fieldWidth;
+    return m_fieldLeft + static_cast<float>(pos) * m_tileWidth;
+}
+
+// Keeps the army a quarter of the screen from the left edge, so the tiles
+// ahead of it are in view, without scrolling past either end of the map.
+void GameApplication::updateCamera(float dt, bool snap) {
+    const float halfWidth = WINDOW_WIDTH / 2;
+    const float worldWidth = posToX(m_simulation->getCurrent().mapSize - 1) + m_fieldLeft;
+    const float target = std::clamp(m_armyPos.getCurrentX() + WINDOW_WIDTH / 4,
+                                    halfWidth, std::max(halfWidth, worldWidth - halfWidth));
+
+    float centerX = m_camera.getCenter().x;
+    centerX = snap ? target : centerX + (target - centerX) * std::min(1.0f, dt * CAMERA_FOLLOW_RATE);
+    m_camera.setCenter({centerX, WINDOW_HEIGHT / 2});
+}
+
+// Tiles whose units can overlap the camera, padded by one tile on each side
+// for tweens that are still catching up with their tile.
+std::pair<int, int> GameApplication::getVisibleTiles() const {
+    const float left = m_camera.getCenter().x - m_camera.getSize().x / 2;
+    const float right = left + m_camera.getSize().x;
+    const int first = static_cast<int>(std::floor((left - m_fieldLeft) / m_tileWidth)) - 1;
+    const int last = static_cast<int>(std::ceil((right - m_fieldLeft) / m_tileWidth)) + 1;
+    return {std::max(first, 0), std::min(last, m_simulation->getCurrent().mapSize - 1)};
 }
 
 void GameApplication::run() {
     sf::Clock clock;
+    sf::Clock frameClock;
+    bool firstFrame = true;
     while (m_window.isOpen()) {
         float dt = clock.restart().asSeconds();
         if (dt > 0.1f) dt = 0.1f;
-        processEvents();
-        update(dt);
-        render();
+        frameClock.restart();
+#ifdef ENABLE_PROFILER
+        m_profiler.beginFrame();
+#endif
+        const bool loading = m_state == GameState::LOADING;
+        {
+            PROFILE_SCOPE(m_profiler, "processEvents");
+            processEvents();
+        }
+        {
+            PROFILE_SCOPE(m_profiler, "update");
+            update(dt);
+        }
+        {
+            PROFILE_SCOPE(m_profiler, "render");
+            render();
+        }
+#ifdef ENABLE_PROFILER
+        m_profiler.endFrame();
+#endif
+
+        // Timed without display(), which waits on the frame limiter.
+        const sf::Time frame = frameClock.getElapsedTime();
+        if (!firstFrame && !loading && frame > m_worstFrame) {
+            m_worstFrame = frame;
+        }
+        firstFrame = firstFrame && loading;
+        m_window.display();
+        recordPresented();
     }
 }
 
@@ -86,6 +183,7 @@ void GameApplication::processEvents() {
         }
 
         if (const auto* keyPressed = event->getIf<sf::Event::KeyPressed>()) {
+            const VoicePool::Clock::time_point pressedAt = VoicePool::Clock::now();
             if (m_state == GameState::MENU) {
                 if (keyPressed->code == sf::Keyboard::Key::Left) {
                     m_menuSelectionIndex = (m_menuSelectionIndex - 1 + 3) % 3;
@@ -98,48 +196,43 @@ void GameApplication::processEvents() {
                     int currentType = static_cast<int>(m_selectedUnits[m_menuSelectionIndex]);
                     m_selectedUnits[m_menuSelectionIndex] = static_cast<UnitType>((currentType - 1 + 3) % 3);
                 } else if (keyPressed->code == sf::Keyboard::Key::Enter) {
-                    std::vector<std::unique_ptr<Patapon>> soldiersConfigFile = GameConfig::loadSoldiers("assets/game_config.txt");
-                    
-                    std::map<UnitType, const Patapon*> templates;
-                    for(const auto& s : soldiersConfigFile) {
-                        if (dynamic_cast<Yaripon*>(s.get())) templates[UnitType::YARIPON] = s.get();
-                        else if (dynamic_cast<Tatepon*>(s.get())) templates[UnitType::TATEPON] = s.get();
-                        else if (dynamic_cast<Yumipon*>(s.get())) templates[UnitType::YUMIPON] = s.get();
+                    if (auto config = m_configWatcher->getConfig(); config != m_config) {
+                        m_config = std::move(config);
+                        m_commandPanelLayer.invalidate();
                     }
 
                     std::vector<std::unique_ptr<Patapon>> newSoldiers;
-
-                    auto createFromTemplate = [&](UnitType type) -> std::unique_ptr<Patapon> {
-                         const Patapon* tpl = templates[type];
-                         if(type == UnitType::YARIPON) return std::make_unique<Yaripon>(tpl->getName(), tpl->getMaxHP(), tpl->getATK(), tpl->getDEF());
-                         if(type == UnitType::TATEPON) return std::make_unique<Tatepon>(tpl->getName(), tpl->getMaxHP(), tpl->getATK(), tpl->getDEF());
-                         if(type == UnitType::YUMIPON) return std::make_unique<Yumipon>(tpl->getName(), tpl->getMaxHP(), tpl->getATK(), tpl->getDEF());
-                         return nullptr;
-                    };
-
-                    newSoldiers.push_back(createFromTemplate(m_selectedUnits[2]));
-                    newSoldiers.push_back(createFromTemplate(m_selectedUnits[1]));
-                    newSoldiers.push_back(createFromTemplate(m_selectedUnits[0]));
-
                     m_pataponIcons.clear();
-                    for(const auto& s : newSoldiers) {
-                         if(dynamic_cast<Yaripon*>(s.get())) m_pataponIcons.push_back(&m_yariponTexture);
-                         else if(dynamic_cast<Tatepon*>(s.get())) m_pataponIcons.push_back(&m_tateponTexture);
-                         else if(dynamic_cast<Yumipon*>(s.get())) m_pataponIcons.push_back(&m_yumiponTexture);
+                    for (UnitType type : {m_selectedUnits[2], m_selectedUnits[1], m_selectedUnits[0]}) {
+                        const Patapon* tpl = m_config->findSoldier(toPataponType(type));
+                        if (!tpl) {
+                            throw InvalidStateException("Config has no soldier for the selected unit type");
+                        }
+                        newSoldiers.push_back(std::unique_ptr<Patapon>(static_cast<Patapon*>(tpl->clone().release())));
+                        m_pataponIcons.push_back(&getUnitTexture(type));
                     }
 
                     std::vector<std::unique_ptr<Enemy>> initialEnemies;
-                    m_game = std::make_unique<Game>(Army(std::move(newSoldiers), 0), std::move(initialEnemies));
+                    m_simulation.reset();
+                    m_simulation = std::make_unique<SimulationThread>(
+                        std::make_unique<Game>(Army(std::move(newSoldiers), 0), std::move(initialEnemies), std::random_device{}(), m_config->getScenario()));
+                    m_simulation->poll();
+                    m_shownAttacks = 0;
+                    m_pendingTraces.clear();
+                    m_renderedTick = 0;
                     
                     m_armyPos = AnimatedPosition();
-                    m_armyPos.snapTo(posToX(m_game->getArmy().getPosition()), m_fieldY);
+                    m_armyPos.snapTo(posToX(m_simulation->getCurrent().armyPosition), m_fieldY);
                     m_enemyPositions.clear();
+                    m_arrowAnim = ArrowAnimation();
+                    updateCamera(0.0f, true);
                     
                     m_state = GameState::GAME;
                 }
             }
             else if (m_state == GameState::GAME) {
-                if (m_game->hasWon()) {
+                const RenderSnapshot& snapshot = m_simulation->getCurrent();
+                if (snapshot.won) {
                     if (keyPressed->code == sf::Keyboard::Key::Space) {
                         if (!m_spaceKeyProcessed) {
                             m_showStats = !m_showStats;
@@ -153,7 +246,7 @@ void GameApplication::processEvents() {
                         m_bossEventTimer = 0.0f;
                         m_bossEventAlpha = 0.0f;
                     }
-                } else if (m_game->hasLost()) {
+                } else if (snapshot.lost) {
                     if (keyPressed->code == sf::Keyboard::Key::Enter) {
                         m_state = GameState::MENU; 
                         m_victoryTimer = 0.0f;
@@ -161,17 +254,15 @@ void GameApplication::processEvents() {
                         m_bossEventAlpha = 0.0f;
                     }
                 } else {
-                    if (!m_game->isBossEventActive() && !m_game->isVictoryMarching()) {
-                        if (keyPressed->code == sf::Keyboard::Key::A) {
-                            m_game->submitCommand("pa");
+                    if (!snapshot.bossEventActive && !snapshot.victoryMarching) {
+                        if (keyPressed->code == sf::Keyboard::Key::A && m_simulation->submit(Drum::PATA, pressedAt)) {
                             m_pataAnimActive = true;
                             m_pataAnimTimer = 0.0f;
-                            m_pataSound.play();
-                        } else if (keyPressed->code == sf::Keyboard::Key::D) {
-                            m_game->submitCommand("po");
+                            m_pataVoices->play(pressedAt);
+                        } else if (keyPressed->code == sf::Keyboard::Key::D && m_simulation->submit(Drum::PON, pressedAt)) {
                             m_ponAnimActive = true;
                             m_ponAnimTimer = 0.0f;
-                            m_ponSound.play();
+                            m_ponVoices->play(pressedAt);
                         }
                     }
                 }
@@ -180,6 +271,14 @@ void GameApplication::processEvents() {
             if (keyPressed->code == sf::Keyboard::Key::Escape) {
                 m_window.close();
             }
+            if (keyPressed->code == sf::Keyboard::Key::F3) {
+                m_showLatency = !m_showLatency;
+            }
+#ifdef ENABLE_PROFILER
+            if (keyPressed->code == sf::Keyboard::Key::F4) {
+                m_showProfiler = !m_showProfiler;
+            }
+#endif
         }
     }
     
@@ -189,18 +288,42 @@ void GameApplication::processEvents() {
 }
 
 void GameApplication::update(float dt) {
-    if (m_game->hasWon() || m_game->hasLost()) return;
-
-    if (m_game->isVictoryMarching()) {
-            m_victoryTimer += dt;
-            
+    if (m_state == GameState::LOADING) {
+        if (m_assets->poll()) {
+            finishLoading();
+        }
+        return;
+    }
+    if (m_state != GameState::GAME) return;
+    PROFILE_SECTION(m_profiler, section, "snapshot");
+    m_pataVoices->update();
+    m_ponVoices->update();
+    m_simulation->poll();
+    const RenderSnapshot& current = m_simulation->getCurrent();
+    const RenderSnapshot& previous = m_simulation->getPrevious();
+    if (current.won || current.lost) return;
+
+    // The simulation runs ahead by up to one tick; blend towards the newest
+    // snapshot by how much of that tick has passed on the window's clock.
+    const float alpha = m_simulation->getInterpolation();
+    const bool consecutive = previous.tick != 0 && previous.tick < current.tick;
+    auto blendTimer = [&](float from, float to, bool wasActive, bool active) {
+        return active && wasActive && consecutive && from <= to ? std::lerp(from, to, alpha) : to;
+    };
+    m_bossEventTimer = blendTimer(previous.bossEventTimer, current.bossEventTimer,
+                                  previous.bossEventActive, current.bossEventActive);
+    m_victoryTimer = blendTimer(previous.victoryTimer, current.victoryTimer,
+                                previous.victoryMarching, current.victoryMarching);
+
+    PROFILE_NEXT(section, "army tween");
+    if (current.victoryMarching) {
             if (m_victoryTimer < 1.0f) {
-                m_armyPos.setTarget(posToX(m_game->getGoal()), m_fieldY);
+                m_armyPos.setTarget(posToX(current.goal), m_fieldY);
                 m_armyPos.update(dt);
             } 
-            else if (m_victoryTimer < 3.0f) {
-                float marchProgress = (m_victoryTimer - 1.0f) / 2.0f;
-                float startX = posToX(m_game->getGoal());
+            else {
+                float marchProgress = std::min(1.0f, (m_victoryTimer - 1.0f) / 2.0f);
+                float startX = posToX(current.goal);
                 float endX = startX + 150.0f;
                 
                 float currentMarchX = startX + (endX - startX) * marchProgress;
@@ -208,59 +331,60 @@ void GameApplication::update(float dt) {
                 m_armyPos.setTarget(currentMarchX, m_fieldY);
                 m_armyPos.update(dt * 0.5f);
             }
-            else {
-                m_game->finishVictoryMarch();
-            }
     } else {
-        m_armyPos.setTarget(posToX(m_game->getArmy().getPosition()), m_fieldY);
+        const float fromX = posToX(consecutive ? previous.armyPosition : current.armyPosition);
+        m_armyPos.setTarget(std::lerp(fromX, posToX(current.armyPosition), alpha), m_fieldY);
         m_armyPos.update(dt);
     }
+    updateCamera(dt, false);
 
-    for (const auto& e : m_game->getEnemies()) {
-        if (m_enemyPositions.find(e.get()) == m_enemyPositions.end()) {
-            AnimatedPosition pos;
-            pos.snapTo(posToX(e->getPos()), m_fieldY);
-            pos.startSpawn();
-            m_enemyPositions[e.get()] = pos;
+    PROFILE_NEXT(section, "enemy tweens");
+    for (const EnemySnapshot& e : current.enemies) {
+        if (e.id.index >= m_enemySeenTick.size()) {
+            m_enemySeenTick.resize(static_cast<std::size_t>(e.id.index) + 1);
+        }
+        m_enemySeenTick[e.id.index] = current.tick;
+
+        AnimatedPosition* pos = m_enemyPositions.find(e.id);
+        if (!pos) {
+            AnimatedPosition spawned;
+            spawned.snapTo(posToX(e.pos), m_fieldY);
+            spawned.startSpawn();
+            pos = &m_enemyPositions.insert(e.id, spawned);
         }
-        m_enemyPositions[e.get()].setTarget(posToX(e->getPos()), m_fieldY);
-        m_enemyPositions[e.get()].update(dt);
+        pos->setTarget(posToX(e.pos), m_fieldY);
+        pos->update(dt);
     }
+    m_enemyPositions.eraseIf([this, &current](EntityId id, const AnimatedPosition&) {
+        return m_enemySeenTick[id.index] != current.tick;
+    });
 
+    PROFILE_NEXT(section, "arrow launch");
     if (m_pataAnimActive) {
         m_pataAnimTimer += dt;
         if (m_pataAnimTimer >= DRUM_ANIM_DURATION) {
             m_pataAnimActive = false;
         }
     }
-    
-    m_game->update();
 
-    if (m_game->pollAttackTriggered()) {
+    if (current.attacks != m_shownAttacks) {
+            m_shownAttacks = current.attacks;
             float sX = m_armyPos.getCurrentX();
             float sY = m_armyPos.getCurrentY(); 
-            float tileWidth = m_fieldWidth / (GameConstants::MAP_SIZE - 1);
-            
-            int currentPos = m_game->getArmy().getPosition();
             int closestDist = 1000;
             
-            for (const auto& e : m_game->getEnemies()) {
-                if (!e->isAlive()) continue;
-                int dist = e->getPos() - currentPos;
-                if (dist >= 0 && dist < closestDist) {
+            for (const EnemySnapshot& e : current.enemies) {
+                const int dist = e.pos - current.armyPosition;
+                if (dist >= 0 && dist <= 3) {
                     closestDist = dist;
+                    break;
                 }
             }
 
-            int maxRange = 0;
-            for(const auto& s : m_game->getArmy().getSoldiers()) {
-                if(s->isAlive()) {
-                    maxRange = std::max(maxRange, s->getRange());
-                }
-            }
+            int maxRange = std::max(0, current.maxLivingRange);
 
             if (closestDist <= 3 && closestDist <= maxRange) {
-                 float tX = sX + static_cast<float>(closestDist) * tileWidth;
+                 float tX = sX + static_cast<float>(closestDist) * m_tileWidth;
                  m_arrowAnim.start(sX, sY, tX);
             }
     }
@@ -272,262 +396,189 @@ void GameApplication::update(float dt) {
             m_ponAnimActive = false;
         }
     }
-    
 
-    
-    if (m_game->isBossEventActive()) {
-            m_bossEventTimer += dt;
-            float fadeDuration = 2.0f;
+    PROFILE_NEXT(section, "boss fade");
+    if (current.bossEventActive) {
+            float fadeDuration = SimulationThread::BOSS_REVEAL_SECONDS;
             float halfDuration = fadeDuration * 0.5f;
             
             if (m_bossEventTimer < halfDuration) {
                 m_bossEventAlpha = m_bossEventTimer / halfDuration;
-            } else if (m_bossEventTimer < fadeDuration) {
-                m_bossEventAlpha = (fadeDuration - m_bossEventTimer) / halfDuration;
             } else {
-                m_game->triggerBossSpawn();
-                m_bossEventTimer = 0.0f;
+                m_bossEventAlpha = std::max(0.0f, (fadeDuration - m_bossEventTimer) / halfDuration);
             }
     }
 }
 
 void GameApplication::render() {
+    if (m_state == GameState::LOADING) {
+        renderLoading();
+        return;
+    }
     if (m_state == GameState::MENU) {
         renderMenu();
-        m_window.display();
         return;
     }
 
     m_window.clear(sf::Color(20, 20, 40));
+    PROFILE_SECTION(m_profiler, section, "sky");
 
+    m_backgroundBatch.clear();
+    m_unitBatch.clear();
+    m_hudBatch.clear();
+    m_foregroundBatch.clear();
+
+    const sf::View screenView = m_window.getDefaultView();
+    m_window.setView(screenView);
     sf::RectangleShape sky(sf::Vector2f(WINDOW_WIDTH, BATTLEFIELD_HEIGHT));
-    sky.setPosition({0, 0});
     sky.setFillColor(sf::Color(100, 150, 220));
     m_window.draw(sky);
 
+    m_window.setView(m_camera);
+    const auto [firstTile, lastTile] = getVisibleTiles();
+
+    const RenderSnapshot& snapshot = m_simulation->getCurrent();
+    m_renderedTick = snapshot.tick;
+    PROFILE_NEXT(section, "totem");
+    if (snapshot.goal >= firstTile && snapshot.goal <= lastTile) {
+        addGoalTotem(m_unitBatch);
+    }
+
+    PROFILE_NEXT(section, "enemies");
+    m_visibleEnemies.clear();
+    for (const EnemySnapshot& e : snapshot.enemies) {
+        if (e.pos < firstTile || e.pos > lastTile) continue;
+        if (const AnimatedPosition* tween = m_enemyPositions.find(e.id)) {
+            m_visibleEnemies.push_back({&e, tween});
+        }
+    }
+
+    for (const VisibleEnemy& visible : m_visibleEnemies) {
+        const AnimatedPosition& pos = *visible.tween;
+        const EnemySnapshot& enemy = *visible.enemy;
+        const sf::Vector2f center(pos.getCurrentX(), pos.getCurrentY());
+        const float scale = pos.getCurrentScale();
+
+        if (enemy.boss) {
+             if (enemy.charging) {
+                  float speed = (enemy.chargeTurns >= 1) ? 20.0f : 10.0f;
+                  float pulse = 0.5f + 0.5f * std::sin(m_bossEventTimer * speed);
+                  m_unitBatch.addCircle(center, m_unitRadius * 2.0f,
+                                        sf::Color(255, 0, 0, static_cast<std::uint8_t>(100 * pulse)));
+             }
+             float r = m_unitRadius * 1.5f;
+             m_unitBatch.addCircle(center, r * scale, sf::Color::Black);
+             m_unitBatch.addRing(center, r * scale, (r + 4) * scale, sf::Color::Red);
+        } else {
+             float r = m_unitRadius;
+             m_unitBatch.addCircle(center, r * scale, sf::Color(255, 80, 80));
+             m_unitBatch.addRing(center, r * scale, (r + 3) * scale, sf::Color(150, 30, 30));
+        }
+    }
+
+    PROFILE_NEXT(section, "army");
+    const sf::Vector2f armyCenter(m_armyPos.getCurrentX(), m_armyPos.getCurrentY());
+    m_unitBatch.addCircle(armyCenter, m_unitRadius, sf::Color(80, 150, 255));
+    m_unitBatch.addRing(armyCenter, m_unitRadius, m_unitRadius + 4, sf::Color(40, 80, 180));
+
+    m_window.draw(m_unitBatch);
+
+    PROFILE_NEXT(section, "labels");
+    std::size_t enemySlot = ENEMY_LABEL_SLOTS;
+    for (const VisibleEnemy& visible : m_visibleEnemies) {
+        const EnemySnapshot& e = *visible.enemy;
+        const AnimatedPosition& pos = *visible.tween;
+
+        bool isBoss = e.boss;
+        sf::Text& typeLabel = m_texts.update(enemySlot, isBoss ? "Z" : "E", 24,
+                                             isBoss ? sf::Color::Red : sf::Color::White, TextOrigin::LABEL);
+        typeLabel.setPosition({pos.getCurrentX(), pos.getCurrentY()});
+        m_window.draw(typeLabel);
+
+        if (e.stack > 1) {
+            sf::Text& countLabel = m_texts.update(enemySlot + 1, std::to_string(e.stack), 24,
+                                                  sf::Color::White, TextOrigin::CENTER);
+            countLabel.setPosition({pos.getCurrentX(), pos.getCurrentY() - m_unitRadius - 30.0f}); 
+            m_window.draw(countLabel);
+        }
+        enemySlot += 2;
+    }
+
+    sf::Text& armyTypeLabel = m_texts.update(ARMY_TYPE_SLOT, "A", 24, sf::Color::White, TextOrigin::LABEL);
+    armyTypeLabel.setPosition({m_armyPos.getCurrentX(), m_armyPos.getCurrentY()});
+    m_window.draw(armyTypeLabel);
+
+    sf::Text& armyCountLabel = m_texts.update(ARMY_COUNT_SLOT, std::to_string(snapshot.livingSoldiers), 24,
+                                              sf::Color::White, TextOrigin::CENTER);
+    armyCountLabel.setPosition({m_armyPos.getCurrentX(), m_armyPos.getCurrentY() - m_unitRadius - 30.0f});
+    m_window.draw(armyCountLabel);
+
+    PROFILE_NEXT(section, "arrow");
+    if (m_arrowAnim.isActive()) {
+        sf::Transform arrow;
+        arrow.translate({m_arrowAnim.getCurrentX(), m_arrowAnim.getCurrentY()});
+        arrow.rotate(sf::degrees(m_arrowAnim.getRotation()));
+        auto at = [&arrow](float x, float y) { return arrow.transformPoint({x, y}); };
+
+        m_foregroundBatch.addQuad(at(-26.0f, -3.0f), at(11.0f, -3.0f), at(11.0f, 3.0f), at(-26.0f, 3.0f), sf::Color::White);
+        m_foregroundBatch.addTriangle(at(9.0f, -10.0f), at(37.0f, 0.0f), at(9.0f, 10.0f), sf::Color::White);
+        m_foregroundBatch.addQuad(at(-25.0f, -2.0f), at(10.0f, -2.0f), at(10.0f, 2.0f), at(-25.0f, 2.0f), sf::Color::Black);
+        m_foregroundBatch.addTriangle(at(10.0f, -8.0f), at(35.0f, 0.0f), at(10.0f, 8.0f), sf::Color::Black);
+    }
+    m_window.draw(m_foregroundBatch);
+
+    m_window.setView(screenView);
+
+    PROFILE_NEXT(section, "hud");
     const float hpCircleRadius = 30.0f;
     const float hpBarWidth = 50.0f;
     const float hpBarHeight = 8.0f;
     float hpStartY = 15.0f;
     float hpSpacing = 70.0f;
     
-    const auto& currentSoldiers = m_game->getArmy().getSoldiers();
+    const std::vector<SoldierSnapshot>& soldiers = snapshot.soldiers;
     std::vector<size_t> displayOrder = {2, 1, 0};
     
-    for (size_t displayIdx = 0; displayIdx < 3 && displayIdx < currentSoldiers.size(); ++displayIdx) {
+    for (size_t displayIdx = 0; displayIdx < 3 && displayIdx < soldiers.size(); ++displayIdx) {
         size_t i = displayOrder[displayIdx];
-        if (i >= currentSoldiers.size()) continue;
+        if (i >= soldiers.size()) continue;
         
         float xPos = 50.0f + displayIdx * hpSpacing;
         float yPos = hpStartY + hpCircleRadius;
 
-        sf::CircleShape circle(hpCircleRadius);
-        circle.setOrigin({hpCircleRadius, hpCircleRadius});
-        circle.setPosition({xPos, yPos});
-        circle.setFillColor(sf::Color(255, 255, 255, 100));
-        circle.setOutlineColor(sf::Color::White);
-        circle.setOutlineThickness(2);
-        m_window.draw(circle);
-
-        sf::Sprite iconSprite(*m_pataponIcons[i]);
-        float iconScale = (hpCircleRadius * 1.6f) / static_cast<float>(m_pataponIcons[i]->getSize().x);
-        iconSprite.setScale({iconScale, iconScale});
-        iconSprite.setOrigin(sf::Vector2f(m_pataponIcons[i]->getSize()) / 2.0f);
-        iconSprite.setPosition({xPos, yPos});
-        m_window.draw(iconSprite);
+        m_backgroundBatch.addCircle({xPos, yPos}, hpCircleRadius, sf::Color(255, 255, 255, 100));
+        m_backgroundBatch.addRing({xPos, yPos}, hpCircleRadius, hpCircleRadius + 2, sf::Color::White);
 
         float barX = xPos - hpBarWidth / 2;
         float barY = yPos + hpCircleRadius + 5;
 
-        sf::RectangleShape hpBack(sf::Vector2f(hpBarWidth, hpBarHeight));
-        hpBack.setPosition({barX, barY});
-        hpBack.setFillColor(sf::Color::Black);
-        m_window.draw(hpBack);
+        m_hudBatch.addRect({barX, barY}, {hpBarWidth, hpBarHeight}, sf::Color::Black);
 
-        float hpPercent = static_cast<float>(currentSoldiers[i]->getHP()) / static_cast<float>(currentSoldiers[i]->getMaxHP());
+        float hpPercent = static_cast<float>(soldiers[i].hp) / static_cast<float>(soldiers[i].maxHp);
         hpPercent = std::clamp(hpPercent, 0.0f, 1.0f);
 
         std::uint8_t r = static_cast<std::uint8_t>((1.0f - hpPercent) * 255);
         std::uint8_t g = static_cast<std::uint8_t>(hpPercent * 255);
-        sf::Color hpColor(r, g, 0);
-
-        sf::RectangleShape hpBar(sf::Vector2f(hpBarWidth * hpPercent, hpBarHeight));
-        hpBar.setPosition({barX, barY});
-        hpBar.setFillColor(hpColor);
-        m_window.draw(hpBar);
+        m_hudBatch.addRect({barX, barY}, {hpBarWidth * hpPercent, hpBarHeight}, sf::Color(r, g, 0));
     }
 
-    float goalX = posToX(m_game->getGoal());
-    
-    sf::Color totemColor = sf::Color::Black;
-    sf::Color accentColor = (m_game->hasWon() || m_game->isVictoryMarching()) ? sf::Color::Green : sf::Color::Red;
-    
-    float groundY = BATTLEFIELD_HEIGHT;
+    m_window.draw(m_backgroundBatch);
 
-    sf::ConvexShape base;
-    base.setPointCount(4);
-    base.setPoint(0, sf::Vector2f(goalX - 30, groundY));
-    base.setPoint(1, sf::Vector2f(goalX + 30, groundY));
-    base.setPoint(2, sf::Vector2f(goalX + 20, groundY - 30));
-    base.setPoint(3, sf::Vector2f(goalX - 20, groundY - 30));
-    base.setFillColor(totemColor);
-    m_window.draw(base);
-
-    sf::RectangleShape lowerBody(sf::Vector2f(40, 50));
-    lowerBody.setOrigin({20, 50});
-    lowerBody.setPosition({goalX, groundY - 30});
-    lowerBody.setFillColor(totemColor);
-    m_window.draw(lowerBody);
-
-    sf::RectangleShape midRing(sf::Vector2f(60, 15));
-    midRing.setOrigin({30, 7.5f});
-    midRing.setPosition({goalX, groundY - 80});
-    midRing.setFillColor(totemColor);
-    m_window.draw(midRing);
-
-    sf::RectangleShape upperBody(sf::Vector2f(30, 40));
-    upperBody.setOrigin({15, 40});
-    upperBody.setPosition({goalX, groundY - 87.5f});
-    upperBody.setFillColor(totemColor);
-    m_window.draw(upperBody);
-
-    sf::ConvexShape topCap;
-    topCap.setPointCount(4);
-    topCap.setPoint(0, sf::Vector2f(goalX - 25, groundY - 127.5f));
-    topCap.setPoint(1, sf::Vector2f(goalX + 25, groundY - 127.5f));
-    topCap.setPoint(2, sf::Vector2f(goalX + 35, groundY - 142.5f));
-    topCap.setPoint(3, sf::Vector2f(goalX - 35, groundY - 142.5f));
-    topCap.setFillColor(totemColor);
-    m_window.draw(topCap);
-
-    sf::RectangleShape antenna(sf::Vector2f(4, 30));
-    antenna.setOrigin({2, 30});
-    antenna.setPosition({goalX, groundY - 142.5f});
-    antenna.setFillColor(totemColor);
-    m_window.draw(antenna);
-
-    sf::CircleShape orb(8);
-    orb.setOrigin({8, 8});
-    orb.setPosition({goalX, groundY - 172.5f});
-    orb.setFillColor(totemColor);
-    m_window.draw(orb);
-
-    sf::CircleShape eye(6);
-    eye.setOrigin({6, 6});
-    eye.setPosition({goalX, groundY - 55});
-    eye.setFillColor(accentColor);
-    m_window.draw(eye);
-
-    sf::CircleShape topEye(4);
-    topEye.setOrigin({4, 4});
-    topEye.setPosition({goalX, groundY - 105});
-    topEye.setFillColor(accentColor);
-    m_window.draw(topEye);
-
-    sf::RectangleShape baseLine(sf::Vector2f(40, 4));
-    baseLine.setOrigin({20, 2});
-    baseLine.setPosition({goalX, groundY - 10});
-    baseLine.setFillColor(accentColor);
-    m_window.draw(baseLine);
-
-    std::map<int, int> enemiesAtPos;
-    for (const auto& e : m_game->getEnemies()) {
-        if (e->isAlive()) {
-            enemiesAtPos[e->getPos()]++;
-        }
-    }
-    std::set<int> drawnEnemyLabels;
-
-    for (const auto& e : m_game->getEnemies()) {
-        if (!e->isAlive()) continue;
-        const AnimatedPosition& pos = m_enemyPositions[e.get()];
-        const Boss* boss = dynamic_cast<const Boss*>(e.get());
-        
-        sf::CircleShape circle;
-        if (boss) {
-            float r = m_unitRadius * 1.5f;
-            circle.setRadius(r);
-            circle.setOrigin({r, r});
-            circle.setScale({pos.getCurrentScale(), pos.getCurrentScale()});
-            circle.setFillColor(sf::Color::Black);
-            circle.setOutlineColor(sf::Color::Red);
-        } else {
-            float r = m_unitRadius;
-            circle.setRadius(r);
-            circle.setOrigin({r, r});
-            circle.setScale({pos.getCurrentScale(), pos.getCurrentScale()});
-            circle.setFillColor(sf::Color(255, 80, 80));
-            circle.setOutlineColor(sf::Color(150, 30, 30));
-        }
-        circle.setPosition({pos.getCurrentX(), pos.getCurrentY()});
-
-        if (boss) {
-             if (boss->isCharging()) {
-                  float speed = (boss->getChargeTurns() >= 1) ? 20.0f : 10.0f;
-                  float pulse = 0.5f + 0.5f * std::sin(m_bossEventTimer * speed);
-                  sf::CircleShape glow(m_unitRadius * 2.0f);
-                  glow.setOrigin({m_unitRadius * 2.0f, m_unitRadius * 2.0f});
-                  glow.setPosition({pos.getCurrentX(), pos.getCurrentY()});
-                  glow.setFillColor(sf::Color(255, 0, 0, 100 * pulse));
-                  m_window.draw(glow);
-             }
-             circle.setOutlineThickness(4);
-        } else {
-             circle.setOutlineThickness(3);
-        }
-        m_window.draw(circle);
-
-        bool isBoss = (boss != nullptr);
-        sf::Text typeLabel(m_font, isBoss ? "Z" : "E", 24);
-        typeLabel.setOrigin({typeLabel.getLocalBounds().size.x / 2, typeLabel.getLocalBounds().size.y / 2 + 5});
-        typeLabel.setPosition({pos.getCurrentX(), pos.getCurrentY()});
-        if (isBoss) {
-                typeLabel.setFillColor(sf::Color::Red);
-        } else {
-                typeLabel.setFillColor(sf::Color::White);
-        }
-        m_window.draw(typeLabel);
-
-        if (drawnEnemyLabels.find(e->getPos()) == drawnEnemyLabels.end()) {
-            int count = enemiesAtPos[e->getPos()];
-            
-            if (count > 1) {
-                sf::Text countLabel(m_font, std::to_string(count), 24);
-                countLabel.setOrigin({countLabel.getLocalBounds().size.x / 2, countLabel.getLocalBounds().size.y / 2});
-                countLabel.setPosition({pos.getCurrentX(), pos.getCurrentY() - m_unitRadius - 30.0f}); 
-                countLabel.setFillColor(sf::Color::White);
-                m_window.draw(countLabel);
-            }
-            
-            drawnEnemyLabels.insert(e->getPos());
-        }
-    }
-
-    sf::CircleShape armyCircle(m_unitRadius);
-    armyCircle.setOrigin({m_unitRadius, m_unitRadius});
-    armyCircle.setPosition({m_armyPos.getCurrentX(), m_armyPos.getCurrentY()});
-    armyCircle.setFillColor(sf::Color(80, 150, 255));
-    armyCircle.setOutlineColor(sf::Color(40, 80, 180));
-    armyCircle.setOutlineThickness(4);
-    m_window.draw(armyCircle);
-
-    sf::Text armyTypeLabel(m_font, "A", 24);
-    armyTypeLabel.setOrigin({armyTypeLabel.getLocalBounds().size.x / 2, armyTypeLabel.getLocalBounds().size.y / 2 + 5});
-    armyTypeLabel.setPosition({m_armyPos.getCurrentX(), m_armyPos.getCurrentY()});
-    armyTypeLabel.setFillColor(sf::Color::White);
-    m_window.draw(armyTypeLabel);
+    for (size_t displayIdx = 0; displayIdx < 3 && displayIdx < soldiers.size(); ++displayIdx) {
+        size_t i = displayOrder[displayIdx];
+        if (i >= soldiers.size()) continue;
 
-    int livingSoldiers = 0;
-    for(const auto& s : m_game->getArmy().getSoldiers()) {
-        if(s->isAlive()) livingSoldiers++;
+        sf::Sprite iconSprite(*m_pataponIcons[i]);
+        float iconScale = (hpCircleRadius * 1.6f) / static_cast<float>(m_pataponIcons[i]->getSize().x);
+        iconSprite.setScale({iconScale, iconScale});
+        iconSprite.setOrigin(sf::Vector2f(m_pataponIcons[i]->getSize()) / 2.0f);
+        iconSprite.setPosition({50.0f + displayIdx * hpSpacing, hpStartY + hpCircleRadius});
+        m_window.draw(iconSprite);
     }
 
-    sf::Text armyCountLabel(m_font, std::to_string(livingSoldiers), 24);
-    armyCountLabel.setOrigin({armyCountLabel.getLocalBounds().size.x / 2, armyCountLabel.getLocalBounds().size.y / 2});
-    armyCountLabel.setPosition({m_armyPos.getCurrentX(), m_armyPos.getCurrentY() - m_unitRadius - 30.0f});
-    armyCountLabel.setFillColor(sf::Color::White);
-    m_window.draw(armyCountLabel);
+    m_window.draw(m_hudBatch);
 
+    PROFILE_NEXT(section, "drums");
     if (m_pataAnimActive) {
         float t = m_pataAnimTimer / DRUM_ANIM_DURATION;
         float alpha = t < 0.3f ? (t / 0.3f) : ((1.0f - t) / 0.7f);
@@ -554,92 +605,178 @@ void GameApplication::render() {
         m_window.draw(m_ponSprite);
     }
 
-    if (m_arrowAnim.isActive()) {
-        sf::ConvexShape arrowShape;
-        arrowShape.setPointCount(7);
-        arrowShape.setPoint(0, sf::Vector2f(-25.0f, -2.0f));
-        arrowShape.setPoint(1, sf::Vector2f(10.0f, -2.0f));
-        arrowShape.setPoint(2, sf::Vector2f(10.0f, -8.0f));
-        arrowShape.setPoint(3, sf::Vector2f(35.0f, 0.0f));
-        arrowShape.setPoint(4, sf::Vector2f(10.0f, 8.0f));
-        arrowShape.setPoint(5, sf::Vector2f(10.0f, 2.0f));
-        arrowShape.setPoint(6, sf::Vector2f(-25.0f, 2.0f));
-
-        arrowShape.setFillColor(sf::Color::Black);
-        arrowShape.setOutlineColor(sf::Color::White);
-        arrowShape.setOutlineThickness(1.0f);
-        
-        arrowShape.setPosition({m_arrowAnim.getCurrentX(), m_arrowAnim.getCurrentY()});
-        arrowShape.setRotation(sf::degrees(m_arrowAnim.getRotation()));
+    PROFILE_NEXT(section, "command bar");
+    m_commandPanelLayer.draw(m_window, [this](sf::RenderTarget& target) { bakeCommandPanel(target); });
 
-        m_window.draw(arrowShape);
-    }
-
-    sf::RectangleShape commandBar(sf::Vector2f(WINDOW_WIDTH, COMMAND_BAR_HEIGHT));
-    commandBar.setPosition({0, BATTLEFIELD_HEIGHT});
-    commandBar.setFillColor(sf::Color::Black);
-    m_window.draw(commandBar);
-
-    sf::RectangleShape separator(sf::Vector2f(WINDOW_WIDTH, 3));
-    separator.setPosition({0, BATTLEFIELD_HEIGHT});
-    separator.setFillColor(sf::Color(100, 100, 100));
-    m_window.draw(separator);
-
-    sf::Text moveCmd(m_font, "Inaintare: PATA PATA PATA PON", 22);
-    moveCmd.setPosition({50, BATTLEFIELD_HEIGHT + 30});
-    moveCmd.setFillColor(sf::Color::Cyan);
-    m_window.draw(moveCmd);
-
-    sf::Text attackCmd(m_font, "Atac: PON PON PATA PON", 22);
-    attackCmd.setPosition({50, BATTLEFIELD_HEIGHT + 65});
-    attackCmd.setFillColor(sf::Color::Red);
-    m_window.draw(attackCmd);
-
-    sf::Text retreatCmd(m_font, "Retragere: PON PATA PON PATA", 22);
-    retreatCmd.setPosition({50, BATTLEFIELD_HEIGHT + 100});
-    retreatCmd.setFillColor(sf::Color::Magenta);
-    m_window.draw(retreatCmd);
-
-    sf::Text controlsLabel(m_font, "Controale: A = PATA | D = PON | ESC = Iesire", 18);
-    controlsLabel.setPosition({50, BATTLEFIELD_HEIGHT + 145});
-    controlsLabel.setFillColor(sf::Color(150, 150, 150));
-    m_window.draw(controlsLabel);
-
-    std::stringstream cmdStream;
-    cmdStream << "Secventa curenta: ";
-    for (const auto& cmd : m_game->getCommands().getCommands()) {
-        if (cmd == "pa") cmdStream << "PATA ";
-        else if (cmd == "po") cmdStream << "PON ";
+    m_sequenceText = "Secventa curenta: ";
+    for (Drum drum : snapshot.commands) {
+        m_sequenceText += drumLabel(drum);
+        m_sequenceText += ' ';
     }
     
-    sf::Text currentSeq(m_font, cmdStream.str(), 20);
+    sf::Text& currentSeq = m_texts.update(SEQUENCE_SLOT, m_sequenceText, 20, sf::Color::Yellow);
     currentSeq.setPosition({500, BATTLEFIELD_HEIGHT + 30});
-    currentSeq.setFillColor(sf::Color::Yellow);
     m_window.draw(currentSeq);
 
-    if (!m_game->getLog().empty()) {
-        sf::Text lastLog(m_font, ">>> " + m_game->getLog().back(), 16);
+    if (!snapshot.lastEvent.empty()) {
+        sf::Text& lastLog = m_texts.update(LAST_LOG_SLOT, snapshot.lastEvent, 16, sf::Color(200, 255, 200));
         lastLog.setPosition({500, BATTLEFIELD_HEIGHT + 100});
-        lastLog.setFillColor(sf::Color(200, 255, 200));
         m_window.draw(lastLog);
     }
 
-    if (m_game->isBossEventActive() && m_bossEventAlpha > 0) {
-            sf::Text bossText(m_font, "BOSSFIGHT", 100);
-            bossText.setOrigin({bossText.getLocalBounds().size.x / 2, bossText.getLocalBounds().size.y / 2});
+    PROFILE_NEXT(section, "overlays");
+    if (snapshot.bossEventActive && m_bossEventAlpha > 0) {
+            sf::Text& bossText = m_texts.update(BOSSFIGHT_SLOT, "BOSSFIGHT", 100,
+                                                sf::Color(255, 0, 0, static_cast<std::uint8_t>(m_bossEventAlpha * 255)),
+                                                TextOrigin::CENTER);
             bossText.setPosition({WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2});
-            bossText.setFillColor(sf::Color(255, 0, 0, static_cast<std::uint8_t>(m_bossEventAlpha * 255)));
             m_window.draw(bossText);
     }
 
-    if (m_game->hasWon()) {
+    if (snapshot.won) {
         if (m_showStats) renderStats();
         else renderWinScreen();
-    } else if (m_game->hasLost()) {
+    } else if (snapshot.lost) {
         renderLoseScreen();
     }
 
-    m_window.display();
+    if (m_showLatency) {
+        renderLatencyOverlay();
+    }
+#ifdef ENABLE_PROFILER
+    if (m_showProfiler) {
+        renderProfiler();
+    }
+#endif
+}
+
+// Called right after display(), so a press counts as presented once a frame
+// drawn from its tick, or a later one, has been handed to the screen.
+void GameApplication::recordPresented() {
+    if (!m_simulation) return;
+
+    InputTrace trace;
+    while (m_simulation->pollTrace(trace)) {
+        m_pendingTraces.push_back(trace);
+    }
+    if (m_state != GameState::GAME) return;
+
+    const auto presentedAt = std::chrono::steady_clock::now();
+    std::erase_if(m_pendingTraces, [this, presentedAt](const InputTrace& pending) {
+        if (pending.tick > m_renderedTick) return false;
+        auto us = [](auto duration) { return std::chrono::duration_cast<std::chrono::microseconds>(duration); };
+        m_inputLatency[0].record(us(pending.drainedAt - pending.pressedAt));
+        m_inputLatency[1].record(us(pending.simulatedAt - pending.drainedAt));
+        m_inputLatency[2].record(us(presentedAt - pending.simulatedAt));
+        m_inputLatency[3].record(us(presentedAt - pending.pressedAt));
+        return true;
+    });
+}
+
+void GameApplication::renderLatencyOverlay() {
+    std::ostringstream ss;
+    ss.setf(std::ios::fixed);
+    ss.precision(1);
+    for (std::size_t stage = 0; stage < LATENCY_STAGES.size(); ++stage) {
+        const LatencyHistogram& histogram = m_inputLatency[stage];
+        auto ms = [](std::chrono::microseconds value) { return static_cast<double>(value.count()) / 1000.0; };
+        ss << LATENCY_STAGES[stage] << ": p50 " << ms(histogram.getPercentile(50))
+           << "  p99 " << ms(histogram.getPercentile(99)) << "  max " << ms(histogram.getMax()) << " ms\n";
+    }
+    ss << "hits: " << m_inputLatency.back().getCount();
+
+    sf::Text& overlay = m_texts.update(LATENCY_SLOT, ss.str(), 16, sf::Color::Yellow);
+    overlay.setPosition({WINDOW_WIDTH - 340, 110});
+    m_window.draw(overlay);
+}
+
+#ifdef ENABLE_PROFILER
+// Frame times of the last few seconds against the 60 FPS budget, oldest on
+// the left, with the smoothed cost of every profiled section beside them.
+void GameApplication::renderProfiler() {
+    const float budgetMs = 1000.0f / 60.0f;
+    const float graphHeight = 100.0f;
+    const float pixelsPerMs = graphHeight / (2 * budgetMs);
+    const sf::Vector2f origin(10.0f, 130.0f);
+    const auto& history = m_profiler.getFrameHistory();
+    const float barWidth = 2.0f;
+
+    m_profilerBatch.clear();
+    m_profilerBatch.addRect(origin, {barWidth * FrameProfiler::HISTORY, graphHeight}, sf::Color(0, 0, 0, 160));
+    for (std::size_t i = 0; i < FrameProfiler::HISTORY; ++i) {
+        const float ms = history[(m_profiler.getHistoryStart() + i) % FrameProfiler::HISTORY];
+        const float height = std::min(graphHeight, ms * pixelsPerMs);
+        const sf::Color color = ms > budgetMs ? sf::Color::Red : ms > budgetMs / 2 ? sf::Color::Yellow : sf::Color::Green;
+        m_profilerBatch.addRect({origin.x + barWidth * static_cast<float>(i), origin.y + graphHeight - height},
+                                {barWidth, height}, color);
+    }
+    m_profilerBatch.addRect({origin.x, origin.y + graphHeight - budgetMs * pixelsPerMs},
+                            {barWidth * FrameProfiler::HISTORY, 1.0f}, sf::Color::White);
+    m_window.draw(m_profilerBatch);
+
+    std::ostringstream ss;
+    ss.setf(std::ios::fixed);
+    ss.precision(2);
+    for (const FrameProfiler::Section& profiled : m_profiler.getSections()) {
+        ss << std::string(static_cast<std::size_t>(profiled.depth) * 2, ' ') << profiled.name << " " << profiled.averageMs << " ms\n";
+    }
+    m_profilerText = ss.str();
+
+    sf::Text& sections = m_texts.update(PROFILER_SLOT, m_profilerText, 14, sf::Color::White);
+    sections.setPosition({origin.x + barWidth * FrameProfiler::HISTORY + 10.0f, origin.y});
+    m_window.draw(sections);
+}
+#endif
+
+void GameApplication::addGoalTotem(ShapeBatch& batch) const {
+    const RenderSnapshot& snapshot = m_simulation->getCurrent();
+    float goalX = posToX(snapshot.goal);
+    
+    const bool victorious = snapshot.won || snapshot.victoryMarching;
+    sf::Color totemColor = sf::Color::Black;
+    sf::Color accentColor = victorious ? sf::Color::Green : sf::Color::Red;
+    
+    float groundY = BATTLEFIELD_HEIGHT;
+
+    batch.addQuad({goalX - 30, groundY}, {goalX + 30, groundY},
+                  {goalX + 20, groundY - 30}, {goalX - 20, groundY - 30}, totemColor);
+    batch.addRect({goalX - 20, groundY - 80}, {40, 50}, totemColor);
+    batch.addRect({goalX - 30, groundY - 87.5f}, {60, 15}, totemColor);
+    batch.addRect({goalX - 15, groundY - 127.5f}, {30, 40}, totemColor);
+    batch.addQuad({goalX - 25, groundY - 127.5f}, {goalX + 25, groundY - 127.5f},
+                  {goalX + 35, groundY - 142.5f}, {goalX - 35, groundY - 142.5f}, totemColor);
+    batch.addRect({goalX - 2, groundY - 172.5f}, {4, 30}, totemColor);
+    batch.addCircle({goalX, groundY - 172.5f}, 8, totemColor);
+    batch.addCircle({goalX, groundY - 55}, 6, accentColor);
+    batch.addCircle({goalX, groundY - 105}, 4, accentColor);
+    batch.addRect({goalX - 20, groundY - 12}, {40, 4}, accentColor);
+}
+
+void GameApplication::bakeCommandPanel(sf::RenderTarget& target) {
+    ShapeBatch batch;
+    batch.addRect({0, BATTLEFIELD_HEIGHT}, {WINDOW_WIDTH, COMMAND_BAR_HEIGHT}, sf::Color::Black);
+    batch.addRect({0, BATTLEFIELD_HEIGHT}, {WINDOW_WIDTH, 3}, sf::Color(100, 100, 100));
+    target.draw(batch);
+
+    sf::Text moveCmd(m_font, "Inaintare: " + chantLabel(*m_config->getScenario().getChants(), Chant::MOVE), 22);
+    moveCmd.setPosition({50, BATTLEFIELD_HEIGHT + 30});
+    moveCmd.setFillColor(sf::Color::Cyan);
+    target.draw(moveCmd);
+
+    sf::Text attackCmd(m_font, "Atac: " + chantLabel(*m_config->getScenario().getChants(), Chant::ATTACK), 22);
+    attackCmd.setPosition({50, BATTLEFIELD_HEIGHT + 65});
+    attackCmd.setFillColor(sf::Color::Red);
+    target.draw(attackCmd);
+
+    sf::Text retreatCmd(m_font, "Retragere: " + chantLabel(*m_config->getScenario().getChants(), Chant::RETREAT), 22);
+    retreatCmd.setPosition({50, BATTLEFIELD_HEIGHT + 100});
+    retreatCmd.setFillColor(sf::Color::Magenta);
+    target.draw(retreatCmd);
+
+    sf::Text controlsLabel(m_font, "Controale: A = PATA | D = PON | ESC = Iesire", 18);
+    controlsLabel.setPosition({50, BATTLEFIELD_HEIGHT + 145});
+    controlsLabel.setFillColor(sf::Color(150, 150, 150));
+    target.draw(controlsLabel);
 }
 
 void GameApplication::renderStats() {
@@ -647,30 +784,25 @@ void GameApplication::renderStats() {
     overlay.setFillColor(sf::Color::Black);
     m_window.draw(overlay);
 
-    sf::Text title(m_font, "STATISTICI", 60);
-    title.setOrigin({title.getLocalBounds().size.x / 2, title.getLocalBounds().size.y / 2});
+    sf::Text& title = m_texts.update(STATS_TITLE_SLOT, "STATISTICI", 60, sf::Color::White, TextOrigin::CENTER);
     title.setPosition({WINDOW_WIDTH / 2, 100});
-    title.setFillColor(sf::Color::White);
     m_window.draw(title);
 
-    const auto& stats = m_game->getStats();
+    const GameStats& stats = m_simulation->getCurrent().stats;
     std::stringstream ss;
     ss << "Damage Dat: " << stats.getDamageDealt() << "\n"
        << "Damage Primit: " << stats.getDamageTaken() << "\n"
        << "Comenzi: " << stats.getCommandsCount() << "\n"
        << "Pasi: " << stats.getStepsTaken() << "\n"
-       << "Ture: " << stats.getTurns();
+       << "Ture: " << stats.getTurns() << "\n"
+       << "Seed: " << stats.getSeed();
     
-    sf::Text statsText(m_font, ss.str(), 30);
-    statsText.setOrigin({statsText.getLocalBounds().size.x / 2, statsText.getLocalBounds().size.y / 2});
+    sf::Text& statsText = m_texts.update(STATS_BODY_SLOT, ss.str(), 30, sf::Color::White, TextOrigin::CENTER);
     statsText.setPosition({WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2});
-    statsText.setFillColor(sf::Color::White);
     m_window.draw(statsText);
 
-    sf::Text backText(m_font, "SPACE: Back", 24);
-    backText.setOrigin({backText.getLocalBounds().size.x / 2, backText.getLocalBounds().size.y / 2});
+    sf::Text& backText = m_texts.update(STATS_BACK_SLOT, "SPACE: Back", 24, sf::Color(150, 150, 150), TextOrigin::CENTER);
     backText.setPosition({WINDOW_WIDTH / 2, WINDOW_HEIGHT - 50});
-    backText.setFillColor(sf::Color(150, 150, 150));
     m_window.draw(backText);
 }
 
@@ -679,22 +811,16 @@ void GameApplication::renderWinScreen() {
     overlay.setFillColor(sf::Color::Black);
     m_window.draw(overlay);
 
-    sf::Text winText(m_font, "Nivel Complet", 80);
-    winText.setOrigin({winText.getLocalBounds().size.x / 2, winText.getLocalBounds().size.y / 2});
+    sf::Text& winText = m_texts.update(RESULT_TITLE_SLOT, "Nivel Complet", 80, sf::Color::Green, TextOrigin::CENTER);
     winText.setPosition({WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2 - 50});
-    winText.setFillColor(sf::Color::Green);
     m_window.draw(winText);
 
-    sf::Text retryText(m_font, "ENTER: Restart\nESC: Iesire", 30);
-    retryText.setOrigin({retryText.getLocalBounds().size.x / 2, retryText.getLocalBounds().size.y / 2});
+    sf::Text& retryText = m_texts.update(RESULT_RETRY_SLOT, "ENTER: Restart\nESC: Iesire", 30, sf::Color::White, TextOrigin::CENTER);
     retryText.setPosition({WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2 + 80});
-    retryText.setFillColor(sf::Color::White);
     m_window.draw(retryText);
     
-    sf::Text statsPrompt(m_font, "SPACE: Stats", 24);
-    statsPrompt.setOrigin({statsPrompt.getLocalBounds().size.x / 2, statsPrompt.getLocalBounds().size.y / 2});
+    sf::Text& statsPrompt = m_texts.update(STATS_PROMPT_SLOT, "SPACE: Stats", 24, sf::Color(150, 150, 150), TextOrigin::CENTER);
     statsPrompt.setPosition({WINDOW_WIDTH / 2, WINDOW_HEIGHT - 50});
-    statsPrompt.setFillColor(sf::Color(150, 150, 150));
     m_window.draw(statsPrompt);
 }
 
@@ -703,16 +829,12 @@ void GameApplication::renderLoseScreen() {
     overlay.setFillColor(sf::Color::Black);
     m_window.draw(overlay);
 
-    sf::Text loseText(m_font, "Nivel Pierdut", 80);
-    loseText.setOrigin({loseText.getLocalBounds().size.x / 2, loseText.getLocalBounds().size.y / 2});
+    sf::Text& loseText = m_texts.update(RESULT_TITLE_SLOT, "Nivel Pierdut", 80, sf::Color::Red, TextOrigin::CENTER);
     loseText.setPosition({WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2 - 50});
-    loseText.setFillColor(sf::Color::Red);
     m_window.draw(loseText);
 
-    sf::Text retryText(m_font, "ENTER: Restart\nESC: Iesire", 30);
-    retryText.setOrigin({retryText.getLocalBounds().size.x / 2, retryText.getLocalBounds().size.y / 2});
+    sf::Text& retryText = m_texts.update(RESULT_RETRY_SLOT, "ENTER: Restart\nESC: Iesire", 30, sf::Color::White, TextOrigin::CENTER);
     retryText.setPosition({WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2 + 80});
-    retryText.setFillColor(sf::Color::White);
     m_window.draw(retryText);
 }
 
@@ -725,21 +847,41 @@ const sf::Texture& GameApplication::getUnitTexture(UnitType type) const {
     }
 }
 
+// Drawn before the font has arrived, so progress is shapes only.
+void GameApplication::renderLoading() {
+    m_window.clear(sf::Color(10, 10, 20));
+    m_window.setView(m_window.getDefaultView());
+
+    const sf::Vector2f barSize(WINDOW_WIDTH / 2, 24.0f);
+    const sf::Vector2f barPos((WINDOW_WIDTH - barSize.x) / 2, (WINDOW_HEIGHT - barSize.y) / 2);
+    m_hudBatch.clear();
+    m_hudBatch.addRectOutline(barPos, barSize, 3.0f, sf::Color(150, 150, 150));
+    m_hudBatch.addRect(barPos, {barSize.x * m_assets->getProgress(), barSize.y}, sf::Color(80, 150, 255));
+    m_window.draw(m_hudBatch);
+}
+
 void GameApplication::renderMenu() {
     m_window.clear(sf::Color(10, 10, 20));
 
-    sf::Text title(m_font, "SELECTEAZA ARMATA", 50);
-    title.setOrigin({title.getLocalBounds().size.x / 2, title.getLocalBounds().size.y / 2});
+    sf::Text& title = m_texts.update(MENU_TITLE_SLOT, "SELECTEAZA ARMATA", 50, sf::Color::White, TextOrigin::CENTER);
     title.setPosition({WINDOW_WIDTH / 2, 80});
-    title.setFillColor(sf::Color::White);
     m_window.draw(title);
 
-    sf::Text instr(m_font, "Sageata STANGA/DREAPTA: Alege Slot\nSageata SUS/JOS: Schimba Unitate\nENTER: Start Lupta", 20);
-    instr.setOrigin({instr.getLocalBounds().size.x / 2, instr.getLocalBounds().size.y / 2});
+    sf::Text& instr = m_texts.update(MENU_HELP_SLOT, "Sageata STANGA/DREAPTA: Alege Slot\nSageata SUS/JOS: Schimba Unitate\nENTER: Start Lupta", 20,
+                                     sf::Color(150, 150, 150), TextOrigin::CENTER);
     instr.setPosition({WINDOW_WIDTH / 2, 160});
-    instr.setFillColor(sf::Color(150, 150, 150));
     m_window.draw(instr);
 
+    if (const std::uint64_t reloads = m_configWatcher->getReloads(); reloads + m_configWatcher->getFailures() > 0) {
+        const std::string error = m_configWatcher->getLastError();
+        sf::Text& status = error.empty()
+            ? m_texts.update(CONFIG_SLOT, "Configuratie reincarcata (" + std::to_string(reloads) + ")", 16,
+                             sf::Color(120, 200, 120), TextOrigin::CENTER)
+            : m_texts.update(CONFIG_SLOT, "Eroare configuratie: " + error, 16, sf::Color(220, 90, 90), TextOrigin::CENTER);
+        status.setPosition({WINDOW_WIDTH / 2, WINDOW_HEIGHT - 40});
+        m_window.draw(status);
+    }
+
     float startX = WINDOW_WIDTH / 2 - 250;
     float slotY = WINDOW_HEIGHT / 2;
     float slotSpacing = 250.0f;
@@ -759,8 +901,7 @@ void GameApplication::renderMenu() {
             m_window.draw(highlight);
         }
 
-        sf::Text slotName(m_font, slotNames[i], 24);
-        slotName.setOrigin({slotName.getLocalBounds().size.x / 2, slotName.getLocalBounds().size.y / 2});
+        sf::Text& slotName = m_texts.update(MENU_SLOT_LABELS + 2 * i, slotNames[i], 24, sf::Color::White, TextOrigin::CENTER);
         slotName.setPosition({x, slotY - 120});
         m_window.draw(slotName);
 
@@ -778,10 +919,8 @@ void GameApplication::renderMenu() {
         else if (type == UnitType::TATEPON) unitName = "TATEPON (Scut)";
         else if (type == UnitType::YUMIPON) unitName = "YUMIPON (Arc)";
 
-        sf::Text uName(m_font, unitName, 20);
-        uName.setOrigin({uName.getLocalBounds().size.x / 2, uName.getLocalBounds().size.y / 2});
+        sf::Text& uName = m_texts.update(MENU_SLOT_LABELS + 2 * i + 1, unitName, 20, sf::Color::Yellow, TextOrigin::CENTER);
         uName.setPosition({x, slotY + 100});
-        uName.setFillColor(sf::Color::Yellow);
         m_window.draw(uName);
     }
 }
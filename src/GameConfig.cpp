@@ -1,53 +1,305 @@
 #include "GameConfig.h"
-#include <fstream>
-#include <sstream>
+#include "MappedFile.h"
 #include <algorithm>
-#include <cctype>
+#include <array>
+#include <charconv>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
 
+namespace {
+    enum : std::size_t { SOLDIER_SECTION, ENEMY_SECTION, BOSS_SECTION, MAP_SECTION, CHANT_SECTION };
 
+    constexpr std::array<std::string_view, CHANT_SECTION + 1> SECTION_KEYWORDS = {"SOLDIER", "ENEMY", "BOSS", "MAP", "CHANT"};
 
-std::vector<std::unique_ptr<Patapon>> GameConfig::loadSoldiers(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        throw ResourceLoadException("Failed to open config file: " + filename);
+    bool isBlank(char c) {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
     }
 
-    std::vector<std::unique_ptr<Patapon>> soldiers;
-    std::string line;
+    bool equalsUpper(std::string_view text, std::string_view upper) {
+        return std::ranges::equal(text, upper, [](char a, char b) {
+            return (a >= 'a' && a <= 'z' ? static_cast<char>(a - 'a' + 'A') : a) == b;
+        });
+    }
+
+    // Splits one line into whitespace-separated views, without copying.
+    class Tokens {
+    public:
+        Tokens(std::string_view line, int lineNumber) : m_rest(line), m_lineNumber(lineNumber) {}
+
+        std::optional<std::string_view> next() {
+            while (!m_rest.empty() && isBlank(m_rest.front())) m_rest.remove_prefix(1);
+            if (m_rest.empty()) return std::nullopt;
+            std::size_t end = 0;
+            while (end < m_rest.size() && !isBlank(m_rest[end])) ++end;
+            const std::string_view token = m_rest.substr(0, end);
+            m_rest.remove_prefix(end);
+            return token;
+        }
+
+        std::string_view word(const char* what) {
+            const auto token = next();
+            if (!token) fail(what);
+            return *token;
+        }
+
+        int number(const char* what) {
+            const std::string_view token = word(what);
+            int value = 0;
+            const auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), value);
+            if (error != std::errc() || end != token.data() + token.size()) fail(what);
+            return value;
+        }
 
-    while (std::getline(file, line)) {
-        if (line.empty() || line[0] == '#') continue;
+        std::optional<int> optionalNumber(const char* what) {
+            const std::string_view saved = m_rest;
+            if (!next()) return std::nullopt;
+            m_rest = saved;
+            return number(what);
+        }
+
+        [[noreturn]] void fail(const char* what) const {
+            throw InvalidInputException(std::string("Invalid ") + what + " format in config at line " +
+                                        std::to_string(m_lineNumber));
+        }
 
-        std::istringstream iss(line);
-        std::string keyword;
-        iss >> keyword;
+    private:
+        std::string_view m_rest;
+        int m_lineNumber;
+    };
+
+    Chant parseChant(std::string_view name) {
+        if (equalsUpper(name, "MOVE")) return Chant::MOVE;
+        if (equalsUpper(name, "ATTACK")) return Chant::ATTACK;
+        if (equalsUpper(name, "RETREAT")) return Chant::RETREAT;
+        throw InvalidInputException("Unknown chant command: " + std::string(name));
+    }
 
-        if (keyword == "SOLDIER") {
-            std::string typeStr, name;
-            int hp, atk, def;
-            
-            if (!(iss >> typeStr >> name >> hp >> atk >> def)) {
-                throw InvalidInputException("Invalid SOLDIER format in config");
+    Drum parseDrum(std::string_view name) {
+        if (equalsUpper(name, "PATA")) return Drum::PATA;
+        if (equalsUpper(name, "PON")) return Drum::PON;
+        throw InvalidInputException("Unknown drum: " + std::string(name));
+    }
+
+    std::unique_ptr<Patapon> parseSoldier(Tokens& tokens) {
+        const std::string_view type = tokens.word("SOLDIER");
+        std::string name(tokens.word("SOLDIER"));
+        const int hp = tokens.number("SOLDIER");
+        const int atk = tokens.number("SOLDIER");
+        const int def = tokens.number("SOLDIER");
+
+        if (equalsUpper(type, "SPEAR")) return std::make_unique<Yaripon>(std::move(name), hp, atk, def);
+        if (equalsUpper(type, "SHIELD")) return std::make_unique<Tatepon>(std::move(name), hp, atk, def);
+        if (equalsUpper(type, "BOW")) return std::make_unique<Yumipon>(std::move(name), hp, atk, def);
+        throw InvalidInputException("Unknown Patapon type: " + std::string(type));
+    }
+
+    // A line that names one of the config sections, kept with its number so
+    // a section parsed later still reports where the error is.
+    struct Line {
+        int number;
+        std::string_view text;
+
+        [[nodiscard]] Tokens tokens() const {
+            Tokens tokens(text, number);
+            tokens.next();
+            return tokens;
+        }
+    };
+
+    std::optional<std::size_t> findSection(std::string_view keyword) {
+        for (std::size_t section = 0; section < SECTION_KEYWORDS.size(); ++section) {
+            if (keyword == SECTION_KEYWORDS[section]) return section;
+        }
+        return std::nullopt;
+    }
+
+    // A later ENEMY, BOSS or MAP line overrides an earlier one.
+    std::optional<Enemy> parseBeast(const std::vector<Line>& lines) {
+        std::optional<Enemy> beast;
+        for (const Line& line : lines) {
+            Tokens tokens = line.tokens();
+            std::string name(tokens.word("ENEMY"));
+            const int hp = tokens.number("ENEMY");
+            const int atk = tokens.number("ENEMY");
+            const int pos = tokens.number("ENEMY");
+            beast.emplace(std::move(name), hp, atk, pos);
+        }
+        return beast;
+    }
+
+    std::optional<Boss> parseBoss(const std::vector<Line>& lines) {
+        std::optional<Boss> boss;
+        for (const Line& line : lines) {
+            Tokens tokens = line.tokens();
+            std::string name(tokens.word("BOSS"));
+            const int hp = tokens.number("BOSS");
+            const int atk = tokens.number("BOSS");
+            const int pos = tokens.number("BOSS");
+            const int bonus = tokens.number("BOSS");
+            boss.emplace(std::move(name), hp, atk, pos, bonus);
+        }
+        return boss;
+    }
+
+    std::optional<MapLayout> parseLayout(const std::vector<Line>& lines) {
+        std::optional<MapLayout> layout;
+        for (const Line& line : lines) {
+            Tokens tokens = line.tokens();
+            layout.emplace();
+            layout->length = tokens.number("MAP");
+            if (const auto waves = tokens.optionalNumber("MAP")) {
+                layout->waves = *waves;
+                layout->waveSpacing = tokens.optionalNumber("MAP").value_or(layout->waveSpacing);
             }
-            
-            std::string upper = typeStr;
-            std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
-
-            if (upper == "SPEAR") {
-                 soldiers.push_back(std::make_unique<Yaripon>(name, hp, atk, def));
-            } else if (upper == "SHIELD") {
-                 soldiers.push_back(std::make_unique<Tatepon>(name, hp, atk, def));
-            } else if (upper == "BOW") {
-                 soldiers.push_back(std::make_unique<Yumipon>(name, hp, atk, def));
-            } else {
-                 throw InvalidInputException("Unknown Patapon type: " + typeStr);
+        }
+        return layout;
+    }
+
+    std::vector<ChantBook::Entry> parseChants(const std::vector<Line>& lines) {
+        std::vector<ChantBook::Entry> chants;
+        for (const Line& line : lines) {
+            Tokens tokens = line.tokens();
+            ChantBook::Entry entry{parseChant(tokens.word("CHANT")), {}};
+            while (const auto drum = tokens.next()) {
+                entry.drums.push_back(parseDrum(*drum));
             }
+            chants.push_back(std::move(entry));
         }
+        return chants;
     }
 
-    if (soldiers.empty()) {
+    std::unique_ptr<Patapon> clonePatapon(const Patapon& prototype) {
+        return std::unique_ptr<Patapon>(static_cast<Patapon*>(prototype.clone().release()));
+    }
+}
+
+// An entry is only reused while the file keeps the modification time and size
+// it was parsed at, so a file edited since (by hand or under a ConfigWatcher)
+// is parsed again.
+std::shared_ptr<const GameConfig> GameConfig::load(const std::string& filename) {
+    struct Entry {
+        std::filesystem::file_time_type modified{};
+        std::uintmax_t size = 0;
+        std::shared_ptr<const GameConfig> config;
+    };
+    static std::mutex mutex;
+    static std::unordered_map<std::string, Entry> cache;
+
+    std::error_code error;
+    const auto modified = std::filesystem::last_write_time(filename, error);
+    const auto size = std::filesystem::file_size(filename, error);
+
+    std::lock_guard lock(mutex);
+    Entry& cached = cache[filename];
+    if (!cached.config || error || cached.modified != modified || cached.size != size) {
+        const MappedFile file(filename);
+        cached.config = std::make_shared<const GameConfig>(parse(file.getView()));
+        cached.modified = modified;
+        cached.size = size;
+    }
+    return cached.config;
+}
+
+GameConfig GameConfig::parse(std::string_view text) {
+    return build(text, nullptr);
+}
+
+GameConfig GameConfig::reparse(std::string_view text) const {
+    return build(text, this);
+}
+
+GameConfig GameConfig::build(std::string_view text, const GameConfig* previous) {
+    static_assert(SECTION_KEYWORDS.size() == SECTION_COUNT);
+    GameConfig config;
+    std::array<std::vector<Line>, SECTION_COUNT> lines;
+
+    int lineNumber = 0;
+    while (!text.empty()) {
+        const std::size_t newline = text.find('\n');
+        const std::string_view line = text.substr(0, newline);
+        text.remove_prefix(newline == std::string_view::npos ? text.size() : newline + 1);
+        ++lineNumber;
+        if (line.empty() || line.front() == '#') continue;
+
+        Tokens tokens(line, lineNumber);
+        const auto keyword = tokens.next();
+        if (!keyword) continue;
+        const auto section = findSection(*keyword);
+        if (!section) continue;
+
+        lines[*section].push_back({lineNumber, line});
+        config.m_sections[*section].append(line).push_back('\n');
+    }
+
+    const auto unchanged = [&](std::size_t section) {
+        return previous != nullptr && previous->m_sections[section] == config.m_sections[section];
+    };
+
+    if (unchanged(SOLDIER_SECTION)) {
+        config.m_soldiers = previous->makeSoldiers();
+    } else {
+        for (const Line& line : lines[SOLDIER_SECTION]) {
+            Tokens tokens = line.tokens();
+            config.m_soldiers.push_back(parseSoldier(tokens));
+        }
+    }
+    if (config.m_soldiers.empty()) {
         throw InvalidStateException("No soldiers found in config file");
     }
 
+    std::shared_ptr<const ChantBook> chantBook;
+    if (unchanged(CHANT_SECTION)) {
+        chantBook = previous->m_scenario.getChants();
+    } else {
+        std::vector<ChantBook::Entry> chants = parseChants(lines[CHANT_SECTION]);
+        chantBook = chants.empty() ? ChantBook::getDefault()
+                                   : std::make_shared<const ChantBook>(std::move(chants));
+    }
+
+    const Scenario defaults(chantBook);
+    const Scenario& base = previous != nullptr ? previous->m_scenario : defaults;
+    const Enemy beast = unchanged(ENEMY_SECTION)
+        ? base.getBeast() : parseBeast(lines[ENEMY_SECTION]).value_or(defaults.getBeast());
+    const Boss boss = unchanged(BOSS_SECTION)
+        ? base.getBoss() : parseBoss(lines[BOSS_SECTION]).value_or(defaults.getBoss());
+    const MapLayout layout = unchanged(MAP_SECTION)
+        ? base.getLayout() : parseLayout(lines[MAP_SECTION]).value_or(defaults.getLayout());
+
+    config.m_scenario = Scenario(beast, boss, std::move(chantBook));
+    config.m_scenario.setLayout(layout);
+    return config;
+}
+
+GameConfig::GameConfig(const GameConfig& other)
+    : m_scenario(other.m_scenario), m_sections(other.m_sections) {
+    m_soldiers = other.makeSoldiers();
+}
+
+GameConfig& GameConfig::operator=(GameConfig other) {
+    swap(*this, other);
+    return *this;
+}
+
+void swap(GameConfig& first, GameConfig& second) noexcept {
+    using std::swap;
+    swap(first.m_soldiers, second.m_soldiers);
+    swap(first.m_scenario, second.m_scenario);
+    swap(first.m_sections, second.m_sections);
+}
+
+std::vector<std::unique_ptr<Patapon>> GameConfig::makeSoldiers() const {
+    std::vector<std::unique_ptr<Patapon>> soldiers;
+    soldiers.reserve(m_soldiers.size());
+    for (const auto& soldier : m_soldiers) {
+        soldiers.push_back(clonePatapon(*soldier));
+    }
     return soldiers;
 }
+
+const Patapon* GameConfig::findSoldier(PataponType type) const {
+    const auto found = std::ranges::find_if(m_soldiers, [type](const auto& soldier) { return soldier->getType() == type; });
+    return found == m_soldiers.end() ? nullptr : found->get();
+}
@@ -1,13 +1,24 @@
 #include "GameStats.h"
 
-GameStats::GameStats() : damageDealt(0), damageTaken(0), commandsCount(0), stepsTaken(0), turns(0) {}
+GameStats::GameStats() : damageDealt(0), damageTaken(0), commandsCount(0), stepsTaken(0), turns(0), seed(0) {}
 
 GameStats::GameStats(int dealt, int taken, int commands, int steps, int turnsCount)
     : damageDealt(dealt), damageTaken(taken), commandsCount(commands),
-      stepsTaken(steps), turns(turnsCount) {}
+      stepsTaken(steps), turns(turnsCount), seed(0) {}
 
 void GameStats::addDamageDealt(int amount) { damageDealt += amount; }
 void GameStats::addDamageTaken(int amount) { damageTaken += amount; }
 void GameStats::addCommand() { commandsCount++; }
 void GameStats::addSteps(int steps) { stepsTaken += steps; }
 void GameStats::addTurn() { turns++; }
+void GameStats::setSeed(std::uint64_t value) { seed = value; }
+
+std::ostream& operator<<(std::ostream& os, const GameStats& stats) {
+    os << "Damage Dat: " << stats.damageDealt
+       << ", Damage Primit: " << stats.damageTaken
+       << ", Comenzi: " << stats.commandsCount
+       << ", Pasi: " << stats.stepsTaken
+       << ", Ture: " << stats.turns
+       << ", Seed: " << stats.seed;
+    return os;
+}
@@ -0,0 +1,64 @@
+#include "KeyScript.h"
+#include "GameException.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+KeyScript::KeyScript(std::string name, std::vector<Drum> drums)
+    : m_name(std::move(name)), m_drums(std::move(drums)) {}
+
+KeyScript KeyScript::loadFromFile(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        throw ResourceLoadException("Failed to open key script: " + filename);
+    }
+
+    std::vector<Drum> drums;
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        if (line.empty() || line[0] == '#') continue;
+
+        std::istringstream iss(line);
+        std::string key;
+        while (iss >> key) {
+            if (key == "A" || key == "a") {
+                drums.push_back(Drum::PATA);
+            } else if (key == "D" || key == "d") {
+                drums.push_back(Drum::PON);
+            } else {
+                throw InvalidInputException("Unknown key '" + key + "' in " + filename + ":" + std::to_string(lineNumber));
+            }
+        }
+    }
+
+    return {filename, std::move(drums)};
+}
+
+std::vector<KeyScript> KeyScript::loadAll(const std::string& path) {
+    if (!std::filesystem::is_directory(path)) {
+        return {loadFromFile(path)};
+    }
+
+    std::vector<std::string> files;
+    for (const auto& entry : std::filesystem::directory_iterator(path)) {
+        if (entry.is_regular_file()) {
+            files.push_back(entry.path().string());
+        }
+    }
+    std::ranges::sort(files);
+
+    std::vector<KeyScript> scripts;
+    scripts.reserve(files.size());
+    for (const auto& file : files) {
+        scripts.push_back(loadFromFile(file));
+    }
+    if (scripts.empty()) {
+        throw ResourceLoadException("No key scripts found in " + path);
+    }
+    return scripts;
+}
@@ -0,0 +1,679 @@
+#include "LaneSimulation.h"
+#include "GameException.h"
+#include "Random.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdlib>
+#include <span>
+
+namespace {
+    // processTurn only spawns while fewer than two enemies stand and update only
+    // spawns into an empty field, so two slots cover every reachable state.
+    constexpr int MAX_ENEMIES = 2;
+
+    // Turns of chant commands decoded ahead for every lane at once.
+    constexpr int COMMAND_STREAM = 64;
+    constexpr int ROLL_STREAM = 32;
+
+    // condition is 0 or 1. Written as a blend rather than ?:, which the
+    // optimizer is free to turn back into a branch around the stores.
+    int select(int condition, int yes, int no) {
+        return no ^ ((yes ^ no) & -condition);
+    }
+
+    int masked(int mask, int value) {
+        return -mask & value;
+    }
+}
+
+// Damage only ever lands on the first living soldier, so soldiers die in order
+// and a lane's army is fully described by the index and HP of its front soldier.
+//
+// Each pass below is a plain loop over the lanes with no calls, no branches and
+// no table lookups, so it compiles to vector code. What cannot be written that
+// way happens outside the turn: a live lane accepts every drum, so its chant
+// commands only depend on its drum stream and are decoded ahead in bulk; spawn
+// rolls are drawn ahead into a bit word; the front soldier's stats are cached
+// per lane and refreshed only on the turns a front soldier dies. A pass that
+// no lane needs this turn (nobody attacking, no second enemy) is skipped as a
+// whole. A lane whose game ends is refilled with the next seed straight away,
+// so every lane stays busy until the range runs out of games.
+template <int LANES>
+class LaneSimulation<LANES>::Kernel {
+public:
+    static_assert(LANES <= 32, "Lane masks are 32 bits wide");
+
+    using Lanes = std::array<int, LANES>;
+
+    Kernel(const LaneSimulation& simulation, std::uint64_t firstSeed, long long games)
+        : m_sim(simulation), m_firstSeed(firstSeed), m_games(games) {
+        m_random.reserve(LANES);
+        for (int l = 0; l < LANES; ++l) {
+            m_random.emplace_back(0);
+            m_policies.push_back(m_sim.m_policy->clone());
+        }
+    }
+
+    template <typename Record>
+    void play(Record&& record) {
+        for (int l = 0; l < LANES; ++l) {
+            load(l, record);
+        }
+        while (m_liveCount > 0) {
+            std::uint32_t refill = 0;
+            for (int l = 0; l < LANES; ++l) {
+                refill |= static_cast<std::uint32_t>(m_live[l] & (m_rollsLeft[l] == 0)) << l;
+            }
+            for (; refill != 0; refill &= refill - 1) {
+                refillRolls(std::countr_zero(refill));
+            }
+
+            step();
+            ++m_slot;
+
+            std::uint32_t finished = 0;
+            for (int l = 0; l < LANES; ++l) {
+                finished |= static_cast<std::uint32_t>(m_live[l] & isFinished(l)) << l;
+            }
+            for (; finished != 0; finished &= finished - 1) {
+                const int l = std::countr_zero(finished);
+                record(result(l));
+                load(l, record);
+            }
+
+            if (m_slot == COMMAND_STREAM) {
+                m_slot = 0;
+                for (int l = 0; l < LANES; ++l) {
+                    if (m_live[l]) decodeCommands(l);
+                }
+            }
+        }
+    }
+
+private:
+    const LaneSimulation& m_sim;
+    std::uint64_t m_firstSeed;
+    long long m_games;
+    long long m_nextGame = 0;
+    int m_liveCount = 0;
+    int m_slot = 0;
+
+    std::vector<std::unique_ptr<DrumPolicy>> m_policies;
+    std::vector<Random> m_random;
+    std::array<std::uint64_t, LANES> m_seed{};
+    std::array<int, LANES> m_chantState{};
+    std::array<Drum, COMMAND_STREAM> m_drums{};
+
+    alignas(64) std::array<Lanes, COMMAND_STREAM> m_commands{};
+    alignas(64) std::array<unsigned, LANES> m_rolls{};
+    alignas(64) Lanes m_rollsLeft{};
+    alignas(64) Lanes m_live{};
+
+    alignas(64) Lanes m_front{};
+    alignas(64) Lanes m_frontHp{};
+    alignas(64) Lanes m_frontDefense{};
+    alignas(64) Lanes m_frontAverageDefense{};
+    alignas(64) Lanes m_nextHp{};
+    alignas(64) Lanes m_armyPos{};
+
+    alignas(64) Lanes m_enemyCount{};
+    alignas(64) std::array<Lanes, MAX_ENEMIES> m_enemyHp{};
+    alignas(64) std::array<Lanes, MAX_ENEMIES> m_enemyPos{};
+    alignas(64) std::array<Lanes, MAX_ENEMIES> m_enemyBoss{};
+    alignas(64) std::array<Lanes, MAX_ENEMIES> m_charging{};
+    alignas(64) std::array<Lanes, MAX_ENEMIES> m_chargeTurns{};
+    alignas(64) std::array<Lanes, MAX_ENEMIES> m_attackCount{};
+
+    alignas(64) Lanes m_turns{};
+    alignas(64) Lanes m_phase{};
+    alignas(64) Lanes m_beastsSpawned{};
+    alignas(64) Lanes m_nextSpawn{};
+    alignas(64) Lanes m_beastsDefeated{};
+    alignas(64) Lanes m_bossSpawned{};
+    alignas(64) Lanes m_won{};
+    alignas(64) Lanes m_lost{};
+
+    alignas(64) Lanes m_damageDealt{};
+    alignas(64) Lanes m_damageTaken{};
+    alignas(64) Lanes m_commandCount{};
+    alignas(64) Lanes m_steps{};
+
+    // Per-pass masks and scratch values, kept as members so every pass only
+    // touches arrays of the one object and needs no aliasing checks.
+    alignas(64) Lanes m_active{};
+    alignas(64) Lanes m_spawn{};
+    alignas(64) Lanes m_placed{};
+    alignas(64) Lanes m_placePos{};
+    alignas(64) Lanes m_swap{};
+    alignas(64) Lanes m_command{};
+    alignas(64) Lanes m_attacking{};
+    alignas(64) Lanes m_distance{};
+    alignas(64) Lanes m_hitDamage{};
+    alignas(64) Lanes m_bossEvent{};
+    alignas(64) Lanes m_victory{};
+
+    [[nodiscard]] int isFinished(int l) const {
+        return m_won[l] | m_lost[l] | (m_turns[l] >= m_sim.m_maxTurns);
+    }
+
+    [[nodiscard]] SimulationResult result(int l) const {
+        GameStats stats(m_damageDealt[l], m_damageTaken[l], m_commandCount[l], m_steps[l], m_turns[l]);
+        stats.setSeed(m_seed[l]);
+        return {m_won[l] != 0, m_lost[l] != 0, stats};
+    }
+
+    // Starts the next game of the range on lane l, recording any game that is
+    // over before its first turn, or retires the lane when none are left.
+    template <typename Record>
+    void load(int l, Record& record) {
+        m_liveCount -= m_live[l];
+        m_live[l] = 0;
+        while (m_nextGame < m_games) {
+            reset(l, m_firstSeed + static_cast<std::uint64_t>(m_nextGame++));
+            m_active.fill(0);
+            m_active[l] = 1;
+            settle();
+            if (!isFinished(l)) {
+                m_live[l] = 1;
+                ++m_liveCount;
+                decodeCommands(l);
+                return;
+            }
+            record(result(l));
+        }
+    }
+
+    void reset(int l, std::uint64_t seed) {
+        m_seed[l] = seed;
+        m_random[static_cast<std::size_t>(l)] = Random(seed);
+        m_policies[static_cast<std::size_t>(l)]->reset(seed);
+        m_chantState[l] = 0;
+        m_rollsLeft[l] = 0;
+        refillRolls(l);
+
+        m_front[l] = 0;
+        m_frontHp[l] = m_sim.m_initialHp[0];
+        m_frontDefense[l] = m_sim.m_defense[0];
+        m_frontAverageDefense[l] = m_sim.m_averageDefense[0];
+        m_nextHp[l] = m_sim.m_initialHp[1];
+        m_armyPos[l] = 0;
+        m_enemyCount[l] = 0;
+        m_turns[l] = 0;
+        m_phase[l] = 0;
+        m_beastsSpawned[l] = 0;
+        m_nextSpawn[l] = m_sim.m_firstSpawn;
+        m_beastsDefeated[l] = 0;
+        m_bossSpawned[l] = 0;
+        m_won[l] = 0;
+        m_lost[l] = 0;
+        m_damageDealt[l] = 0;
+        m_damageTaken[l] = 0;
+        m_commandCount[l] = 0;
+        m_steps[l] = 0;
+    }
+
+    // Fills lane l's commands from the current slot to the end of the stream,
+    // following the chant automaton exactly as Game::submitCommand would.
+    void decodeCommands(int l) {
+        const std::span<Drum> drums(m_drums.data() + m_slot, m_drums.data() + COMMAND_STREAM);
+        m_policies[static_cast<std::size_t>(l)]->fill(drums);
+
+        const ChantBook& chants = *m_sim.m_chants;
+        int state = m_chantState[l];
+        for (int slot = m_slot; slot < COMMAND_STREAM; ++slot) {
+            state = chants.advance(state, m_drums[static_cast<std::size_t>(slot)]);
+            const Chant chant = chants.getMatch(state);
+            m_commands[static_cast<std::size_t>(slot)][l] = static_cast<int>(chant);
+            state = chant == Chant::NONE ? state : 0;
+        }
+        m_chantState[l] = state;
+    }
+
+    void refillRolls(int l) {
+        Random& random = m_random[static_cast<std::size_t>(l)];
+        unsigned rolls = 0;
+        for (int i = 0; i < ROLL_STREAM; ++i) {
+            rolls |= static_cast<unsigned>(random.nextBelow(100) < 10) << i;
+        }
+        m_rolls[l] = rolls;
+        m_rollsLeft[l] = ROLL_STREAM;
+    }
+
+    // One call of submitCommand followed by settle, as Simulation::run plays it.
+    void step() {
+        rollSpawns();
+        spawnBeasts();
+        moveArmy();
+        attack<0>();
+        attack<1>();
+        m_active = m_live;
+        cleanupDeadEnemies();
+        advanceTurn();
+        enemiesAttack<0>();
+        enemiesAttack<1>();
+        enemiesAdvance();
+        m_active = m_live;
+        cleanupDeadEnemies();
+        m_active = m_live;
+        settle();
+    }
+
+    // The spawn roll of processTurn. Draws one roll per lane still owed waves.
+    void rollSpawns() {
+        const int waves = m_sim.m_waves;
+        for (int l = 0; l < LANES; ++l) {
+            const int roll = m_live[l] & (m_beastsSpawned[l] < waves);
+            m_spawn[l] = roll & static_cast<int>(m_rolls[l] & 1u);
+            m_rolls[l] ^= (m_rolls[l] ^ (m_rolls[l] >> 1)) & (0u - static_cast<unsigned>(roll));
+            m_rollsLeft[l] -= roll;
+        }
+    }
+
+    // The chant command and its move or retreat.
+    void moveArmy() {
+        const int goal = m_sim.m_goal;
+        const int soldiers = m_sim.m_soldierCount;
+        m_command = m_commands[static_cast<std::size_t>(m_slot)];
+        for (int l = 0; l < LANES; ++l) {
+            const int command = masked(m_live[l], m_command[l]);
+            const int move = command == static_cast<int>(Chant::MOVE);
+            const int retreat = command == static_cast<int>(Chant::RETREAT);
+            const int standing = m_front[l] < soldiers;
+            m_attacking[l] = (command == static_cast<int>(Chant::ATTACK)) & standing;
+            m_commandCount[l] += command != 0;
+
+            const int army = m_armyPos[l];
+            const int alive0 = (m_enemyCount[l] > 0) & (m_enemyHp[0][l] > 0);
+            const int alive1 = (m_enemyCount[l] > 1) & (m_enemyHp[1][l] > 0);
+            const int distance = select(alive0 | alive1, 1, 3);
+            const int target = std::min(army + distance, goal);
+            const int blocked = (alive0 & (m_enemyPos[0][l] > army) & (m_enemyPos[0][l] <= target))
+                              | (alive1 & (m_enemyPos[1][l] > army) & (m_enemyPos[1][l] <= target));
+            const int advance = move & (blocked == 0);
+            const int back = retreat & (army >= 1);
+            m_steps[l] += masked(advance, distance) + back;
+            m_armyPos[l] = army + masked(advance & standing, distance) - (back & standing);
+        }
+    }
+
+    // handleAttack for one enemy slot: the closest enemy in reach takes the
+    // combined damage of every soldier from the front back that reaches it.
+    template <int K>
+    void attack() {
+        if (!any(m_attacking)) return;
+        if constexpr (K == 0) {
+            for (int l = 0; l < LANES; ++l) {
+                m_swap[l] = m_attacking[l] & (m_enemyCount[l] == 2) & (m_enemyPos[0][l] > m_enemyPos[1][l]);
+            }
+            swapSlots();
+        }
+
+        for (int l = 0; l < LANES; ++l) {
+            m_distance[l] = m_enemyPos[K][l] - m_armyPos[l];
+            m_hitDamage[l] = 0;
+        }
+        for (int s = 0; s < m_sim.m_soldierCount; ++s) {
+            const int damage = m_sim.m_soldierDamage[static_cast<std::size_t>(s)];
+            const int range = m_sim.m_soldierRange[static_cast<std::size_t>(s)];
+            for (int l = 0; l < LANES; ++l) {
+                m_hitDamage[l] += masked((m_front[l] <= s) & (range >= m_distance[l]), damage);
+            }
+        }
+
+        const int beastDamage = m_sim.m_beastDamage;
+        const int bossDamage = m_sim.m_bossDamage;
+        int died = 0;
+        for (int l = 0; l < LANES; ++l) {
+            const int alive = (m_enemyCount[l] > K) & (m_enemyHp[K][l] > 0);
+            const int candidate = m_attacking[l] & alive & (m_enemyPos[K][l] >= m_armyPos[l]);
+            const int dmg = masked(candidate, m_hitDamage[l]);
+            const int hit = dmg > 0;
+
+            const int enemyHp = m_enemyHp[K][l];
+            const int newHp = std::max(0, enemyHp - dmg);
+            m_damageDealt[l] += enemyHp - newHp;
+            m_enemyHp[K][l] = newHp;
+
+            // The survivor strikes back; it hits the front soldier for at
+            // least one point after defense.
+            const int enemyDamage = select(m_enemyBoss[K][l], bossDamage, beastDamage);
+            const int retaliate = std::max(1, enemyDamage - m_frontAverageDefense[l]);
+            const int retaliates = hit & (newHp > 0);
+            const int frontHp = m_frontHp[l];
+            const int effective = std::max(1, retaliate - m_frontDefense[l]);
+            const int survivorHp = std::max(0, frontHp - effective);
+            const int dies = retaliates & (survivorHp == 0);
+            m_damageTaken[l] += masked(retaliates, std::min(frontHp, retaliate));
+            m_frontHp[l] = select(retaliates, select(dies, m_nextHp[l], survivorHp), frontHp);
+            m_front[l] += dies;
+            died |= dies;
+
+            m_attacking[l] &= hit == 0;
+        }
+        if (died) refreshFront();
+    }
+
+    template <int K>
+    void enemiesAttack() {
+        int pending = 0;
+        for (int l = 0; l < LANES; ++l) {
+            pending |= m_live[l] & ((m_phase[l] & 1) == 0) & (m_enemyCount[l] > K);
+        }
+        if (pending == 0) return;
+        const int soldiers = m_sim.m_soldierCount;
+        const int beastDamage = m_sim.m_beastDamage;
+        const int bossDamage = m_sim.m_bossDamage;
+        int died = 0;
+        for (int l = 0; l < LANES; ++l) {
+            const int alive = (m_enemyCount[l] > K) & (m_enemyHp[K][l] > 0);
+            const int valid = m_live[l] & ((m_phase[l] & 1) == 0) & alive;
+            const int near = std::abs(m_enemyPos[K][l] - m_armyPos[l]) <= 1;
+            const int boss = m_enemyBoss[K][l];
+            const int wasCharging = m_charging[K][l];
+
+            const int beastHit = valid & (boss == 0) & near;
+
+            const int charging = valid & boss & wasCharging;
+            const int release = charging & (m_chargeTurns[K][l] >= 1);
+            const int chargedHit = release & near;
+
+            const int idle = valid & boss & (wasCharging == 0) & near;
+            const int startCharge = idle & ((m_attackCount[K][l] & 1) == 1);
+            const int bossHit = idle & (startCharge == 0);
+
+            m_chargeTurns[K][l] = select(release | startCharge, 0, m_chargeTurns[K][l] + (charging & (release == 0)));
+            m_charging[K][l] = select(release, 0, startCharge | wasCharging);
+            m_attackCount[K][l] += idle;
+
+            const int dmg = masked(beastHit, beastDamage) + masked(chargedHit, bossDamage * 2) + masked(bossHit, bossDamage);
+            const int hits = (beastHit | chargedHit | bossHit) & (m_front[l] < soldiers);
+            const int frontHp = m_frontHp[l];
+            const int effective = std::max(1, dmg - m_frontDefense[l]);
+            const int survivorHp = std::max(0, frontHp - effective);
+            const int dies = hits & (survivorHp == 0);
+            m_damageTaken[l] += masked(hits, std::min(frontHp, effective));
+            m_frontHp[l] = select(hits, select(dies, m_nextHp[l], survivorHp), frontHp);
+            m_front[l] += dies;
+            died |= dies;
+        }
+        if (died) refreshFront();
+    }
+
+    void enemiesAdvance() {
+        int pending = 0;
+        for (int l = 0; l < LANES; ++l) {
+            pending |= m_live[l] & (m_phase[l] == 3) & (m_enemyCount[l] > 0);
+        }
+        if (pending == 0) return;
+        static_assert(MAX_ENEMIES == 2, "enemiesAdvance moves exactly two slots");
+        enemyAdvance<0>();
+        enemyAdvance<1>();
+    }
+
+    template <int K>
+    void enemyAdvance() {
+        const int mapSize = m_sim.m_mapSize;
+        for (int l = 0; l < LANES; ++l) {
+            const int alive = (m_enemyCount[l] > K) & (m_enemyHp[K][l] > 0);
+            const int valid = m_live[l] & (m_phase[l] == 3) & alive;
+            const int pos = m_enemyPos[K][l];
+            const int army = m_armyPos[l];
+            const int forward = pos - 1;
+            const int backward = pos + 1;
+            const int advance = (pos > army) & (forward > army) & (forward >= 0) & (forward < mapSize);
+            const int close = (pos < army) & (backward < army) & (backward >= 0) & (backward < mapSize);
+            m_enemyPos[K][l] = select(valid & advance, forward, select(valid & close, backward, pos));
+        }
+    }
+
+    // Game::update for the m_active lanes, then the boss reveal it triggers.
+    void settle() {
+        update();
+        if (any(m_bossEvent)) {
+            const int bossSpawn = m_sim.m_bossSpawn;
+            for (int l = 0; l < LANES; ++l) {
+                m_spawn[l] = m_bossEvent[l] & (m_bossSpawned[l] == 0);
+                m_active[l] = m_bossEvent[l] & (m_victory[l] == 0);
+                m_placePos[l] = bossSpawn;
+            }
+            placeEnemies(m_sim.m_bossHp, 1);
+            for (int l = 0; l < LANES; ++l) {
+                m_bossSpawned[l] |= m_placed[l];
+            }
+            update();
+        }
+        for (int l = 0; l < LANES; ++l) {
+            m_won[l] |= m_victory[l];
+            m_victory[l] = 0;
+        }
+    }
+
+    // Sets m_bossEvent where the boss is due and adds to m_victory where the
+    // army reached the goal.
+    void update() {
+        const int waves = m_sim.m_waves;
+        for (int l = 0; l < LANES; ++l) {
+            const int running = m_active[l] & (m_won[l] == 0) & (m_lost[l] == 0);
+            const int early = m_beastsSpawned[l] < waves;
+            const int empty = m_enemyCount[l] == 0;
+            m_spawn[l] = running & early & empty & (m_armyPos[l] < m_nextSpawn[l]);
+            m_bossEvent[l] = running & (early == 0) & (m_beastsDefeated[l] >= waves) & (m_bossSpawned[l] == 0) & empty;
+            m_active[l] = running;
+        }
+        spawnBeasts();
+        cleanupDeadEnemies();
+
+        const int goal = m_sim.m_goal;
+        const int soldiers = m_sim.m_soldierCount;
+        for (int l = 0; l < LANES; ++l) {
+            const int running = m_active[l];
+            const int defeated = m_front[l] >= soldiers;
+            const int reachedGoal = (m_armyPos[l] >= goal) & m_bossSpawned[l] & (m_enemyCount[l] == 0);
+            m_lost[l] |= running & defeated;
+            m_victory[l] |= running & (defeated == 0) & reachedGoal;
+        }
+    }
+
+    // Compacts the m_active lanes' enemy slots so the living come first.
+    void cleanupDeadEnemies() {
+        static_assert(MAX_ENEMIES == 2, "cleanupDeadEnemies compacts exactly two slots");
+        int swaps = 0;
+        for (int l = 0; l < LANES; ++l) {
+            const int count = m_enemyCount[l];
+            const int dead0 = m_active[l] & (count > 0) & (m_enemyHp[0][l] <= 0);
+            const int dead1 = m_active[l] & (count > 1) & (m_enemyHp[1][l] <= 0);
+            m_beastsDefeated[l] += (dead0 & (m_enemyBoss[0][l] == 0)) + (dead1 & (m_enemyBoss[1][l] == 0));
+            m_swap[l] = dead0 & (dead1 == 0) & (count == 2);
+            m_enemyCount[l] = count - dead0 - dead1;
+            swaps |= m_swap[l];
+        }
+        if (swaps) swapSlots();
+    }
+
+    // m_phase is the turn count modulo 6: enemies attack on even turns and
+    // advance on odd turns that are a multiple of three.
+    void advanceTurn() {
+        for (int l = 0; l < LANES; ++l) {
+            m_turns[l] += m_live[l];
+            m_phase[l] = select(m_live[l], select(m_phase[l] == 5, 0, m_phase[l] + 1), m_phase[l]);
+        }
+    }
+
+    [[nodiscard]] static bool any(const Lanes& mask) {
+        int any = 0;
+        for (int l = 0; l < LANES; ++l) {
+            any |= mask[l];
+        }
+        return any != 0;
+    }
+
+    // A beast for every m_spawn lane with a free slot. The spawn position of
+    // the next wave moves back by the wave spacing until the last wave, as
+    // Scenario::getWaveSpawn lays them out.
+    void spawnBeasts() {
+        if (!any(m_spawn)) return;
+        for (int l = 0; l < LANES; ++l) {
+            m_placePos[l] = m_nextSpawn[l];
+        }
+        placeEnemies(m_sim.m_beastHp, 0);
+        const int waves = m_sim.m_waves;
+        const int spacing = m_sim.m_waveSpacing;
+        for (int l = 0; l < LANES; ++l) {
+            m_beastsSpawned[l] += m_placed[l];
+            m_nextSpawn[l] += masked(m_placed[l] & (m_beastsSpawned[l] < waves), spacing);
+        }
+    }
+
+    // Puts an enemy at m_placePos into the first free slot of every m_spawn
+    // lane that has one, and marks those lanes in m_placed.
+    void placeEnemies(int hp, int boss) {
+        static_assert(MAX_ENEMIES == 2, "placeEnemies fills exactly two slots");
+        for (int l = 0; l < LANES; ++l) {
+            const int count = m_enemyCount[l];
+            const int placed = m_spawn[l] & (count < MAX_ENEMIES);
+            const int first = placed & (count == 0);
+            const int second = placed & (count == 1);
+            const int pos = m_placePos[l];
+            m_enemyHp[0][l] = select(first, hp, m_enemyHp[0][l]);
+            m_enemyPos[0][l] = select(first, pos, m_enemyPos[0][l]);
+            m_enemyBoss[0][l] = select(first, boss, m_enemyBoss[0][l]);
+            m_charging[0][l] = masked(first == 0, m_charging[0][l]);
+            m_chargeTurns[0][l] = masked(first == 0, m_chargeTurns[0][l]);
+            m_attackCount[0][l] = masked(first == 0, m_attackCount[0][l]);
+            m_enemyHp[1][l] = select(second, hp, m_enemyHp[1][l]);
+            m_enemyPos[1][l] = select(second, pos, m_enemyPos[1][l]);
+            m_enemyBoss[1][l] = select(second, boss, m_enemyBoss[1][l]);
+            m_charging[1][l] = masked(second == 0, m_charging[1][l]);
+            m_chargeTurns[1][l] = masked(second == 0, m_chargeTurns[1][l]);
+            m_attackCount[1][l] = masked(second == 0, m_attackCount[1][l]);
+            m_enemyCount[l] = count + placed;
+            m_placed[l] = placed;
+        }
+    }
+
+    // Swaps the two enemy slots of every m_swap lane.
+    void swapSlots() {
+        for (int l = 0; l < LANES; ++l) {
+            const int mask = -m_swap[l];
+            int d = (m_enemyHp[0][l] ^ m_enemyHp[1][l]) & mask;
+            m_enemyHp[0][l] ^= d;
+            m_enemyHp[1][l] ^= d;
+            d = (m_enemyPos[0][l] ^ m_enemyPos[1][l]) & mask;
+            m_enemyPos[0][l] ^= d;
+            m_enemyPos[1][l] ^= d;
+            d = (m_enemyBoss[0][l] ^ m_enemyBoss[1][l]) & mask;
+            m_enemyBoss[0][l] ^= d;
+            m_enemyBoss[1][l] ^= d;
+            d = (m_charging[0][l] ^ m_charging[1][l]) & mask;
+            m_charging[0][l] ^= d;
+            m_charging[1][l] ^= d;
+            d = (m_chargeTurns[0][l] ^ m_chargeTurns[1][l]) & mask;
+            m_chargeTurns[0][l] ^= d;
+            m_chargeTurns[1][l] ^= d;
+            d = (m_attackCount[0][l] ^ m_attackCount[1][l]) & mask;
+            m_attackCount[0][l] ^= d;
+            m_attackCount[1][l] ^= d;
+        }
+    }
+
+    // Re-reads the cached front soldier stats after a front soldier died.
+    void refreshFront() {
+        for (int s = 0; s <= m_sim.m_soldierCount; ++s) {
+            const auto index = static_cast<std::size_t>(s);
+            const int defense = m_sim.m_defense[index];
+            const int averageDefense = m_sim.m_averageDefense[index];
+            const int nextHp = s < m_sim.m_soldierCount ? m_sim.m_initialHp[index + 1] : 0;
+            for (int l = 0; l < LANES; ++l) {
+                const int here = m_front[l] == s;
+                m_frontDefense[l] = select(here, defense, m_frontDefense[l]);
+                m_frontAverageDefense[l] = select(here, averageDefense, m_frontAverageDefense[l]);
+                m_nextHp[l] = select(here, nextHp, m_nextHp[l]);
+            }
+        }
+    }
+};
+
+template <int LANES>
+LaneSimulation<LANES>::LaneSimulation(const Army& army, const DrumPolicy& policy, const Scenario& scenario, int maxTurns)
+    : m_policy(policy.clone()), m_chants(scenario.getChants()), m_maxTurns(maxTurns),
+      m_soldierCount(static_cast<int>(army.getSoldierCount())) {
+    if (maxTurns <= 0) {
+        throw InvalidInputException("Simulation turn limit must be positive");
+    }
+
+    for (const auto& s : army.getSoldiers()) {
+        if (!s.isAlive()) {
+            throw InvalidInputException("LaneSimulation needs an army with every soldier alive");
+        }
+        m_initialHp.push_back(s.getHP());
+        m_defense.push_back(s.getDEF());
+        m_soldierDamage.push_back(s.dealDamage());
+        m_soldierRange.push_back(s.getRange());
+    }
+    m_initialHp.push_back(0);
+    m_defense.push_back(0);
+
+    m_averageDefense.assign(static_cast<std::size_t>(m_soldierCount) + 1, 0);
+    for (int front = 0; front < m_soldierCount; ++front) {
+        int defense = 0;
+        for (int i = front; i < m_soldierCount; ++i) {
+            defense += m_defense[static_cast<std::size_t>(i)];
+        }
+        m_averageDefense[static_cast<std::size_t>(front)] = defense / (m_soldierCount - front);
+    }
+
+    m_mapSize = scenario.getLayout().length;
+    m_goal = scenario.getGoal();
+    m_waves = scenario.getLayout().waves;
+    m_waveSpacing = scenario.getLayout().waveSpacing;
+    m_firstSpawn = scenario.getWaveSpawn(0);
+    m_bossSpawn = scenario.getBossSpawn();
+    m_beastHp = scenario.getBeast().getHP();
+    m_beastDamage = scenario.getBeast().dealDamage();
+    m_bossHp = scenario.getBoss().getHP();
+    m_bossDamage = scenario.getBoss().dealDamage();
+}
+
+template <int LANES>
+std::vector<SimulationResult> LaneSimulation<LANES>::runGames(std::uint64_t firstSeed, long long games) const {
+    std::vector<SimulationResult> results(static_cast<std::size_t>(std::max(0LL, games)), SimulationResult(false, false, GameStats()));
+    Kernel kernel(*this, firstSeed, games);
+    kernel.play([&results, firstSeed](const SimulationResult& result) {
+        results[static_cast<std::size_t>(result.getStats().getSeed() - firstSeed)] = result;
+    });
+    return results;
+}
+
+template <int LANES>
+BatchStats LaneSimulation<LANES>::runRange(long long first, long long last, std::uint64_t baseSeed) const {
+    BatchStats stats;
+    Kernel kernel(*this, baseSeed + static_cast<std::uint64_t>(first), last - first);
+    kernel.play([&stats](const SimulationResult& result) { stats.record(result); });
+    return stats;
+}
+
+template <int LANES>
+BatchStats LaneSimulation<LANES>::run(long long games, std::uint64_t baseSeed, ThreadPool& pool) const {
+    if (games <= 0) {
+        throw InvalidInputException("Number of games must be positive");
+    }
+
+    std::vector<BatchStats> perWorker(pool.size());
+    for (long long first = 0; first < games; first += GAMES_PER_TASK) {
+        long long last = std::min(games, first + GAMES_PER_TASK);
+        pool.submit([this, &perWorker, first, last, baseSeed](std::size_t worker) {
+            perWorker[worker].merge(runRange(first, last, baseSeed));
+        });
+    }
+    pool.wait();
+
+    BatchStats total;
+    for (const auto& stats : perWorker) {
+        total.merge(stats);
+    }
+    return total;
+}
+
+template class LaneSimulation<8>;
+template class LaneSimulation<16>;
@@ -0,0 +1,66 @@
+#include "LatencyHistogram.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <ostream>
+
+std::size_t LatencyHistogram::bucketOf(std::uint64_t value) {
+    if (value < SUB_BUCKETS) return static_cast<std::size_t>(value);
+    const unsigned shift = static_cast<unsigned>(std::bit_width(value)) - SUB_BUCKET_BITS;
+    return shift * (SUB_BUCKETS / 2) + static_cast<std::size_t>(value >> shift);
+}
+
+std::uint64_t LatencyHistogram::upperBound(std::size_t bucket) {
+    if (bucket < SUB_BUCKETS) return bucket;
+    const std::uint64_t half = SUB_BUCKETS / 2;
+    const auto shift = static_cast<unsigned>((bucket - half) / half);
+    const std::uint64_t sub = bucket - shift * half;
+    return ((sub + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(std::chrono::microseconds value) {
+    const auto us = static_cast<std::uint64_t>(std::max<std::int64_t>(0, value.count()));
+    ++m_buckets[bucketOf(us)];
+    ++m_count;
+    m_total += us;
+    m_min = std::min(m_min, us);
+    m_max = std::max(m_max, us);
+}
+
+void LatencyHistogram::reset() {
+    *this = LatencyHistogram();
+}
+
+std::chrono::microseconds LatencyHistogram::getMin() const {
+    return std::chrono::microseconds(m_count == 0 ? 0 : m_min);
+}
+
+std::chrono::microseconds LatencyHistogram::getMean() const {
+    return std::chrono::microseconds(m_count == 0 ? 0 : m_total / m_count);
+}
+
+std::chrono::microseconds LatencyHistogram::getPercentile(double percentile) const {
+    if (m_count == 0) return std::chrono::microseconds{0};
+    const double clamped = std::clamp(percentile, 0.0, 100.0);
+    const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(m_count))));
+
+    std::uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < m_buckets.size(); ++bucket) {
+        seen += m_buckets[bucket];
+        if (seen >= rank) {
+            return std::chrono::microseconds(std::min(upperBound(bucket), m_max));
+        }
+    }
+    return getMax();
+}
+
+void LatencyHistogram::print(std::ostream& out, std::string_view label) const {
+    auto ms = [](std::chrono::microseconds value) { return static_cast<double>(value.count()) / 1000.0; };
+    out << label << ": " << m_count << " samples";
+    if (m_count > 0) {
+        out << ", min " << ms(getMin()) << " ms, mean " << ms(getMean())
+            << " ms, p50 " << ms(getPercentile(50)) << " ms, p90 " << ms(getPercentile(90))
+            << " ms, p99 " << ms(getPercentile(99)) << " ms, max " << ms(getMax()) << " ms";
+    }
+    out << '\n';
+}
@@ -0,0 +1,75 @@
+#include "MappedFile.h"
+#include "GameException.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+
+MappedFile::MappedFile(const std::string& filename) {
+    m_file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                         OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (m_file == INVALID_HANDLE_VALUE) {
+        m_file = nullptr;
+        throw ResourceLoadException("Failed to open config file: " + filename);
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(m_file, &size)) {
+        CloseHandle(m_file);
+        throw ResourceLoadException("Failed to read config file: " + filename);
+    }
+    m_size = static_cast<std::size_t>(size.QuadPart);
+    if (m_size == 0) return;
+
+    m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_mapping) {
+        m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+    }
+    if (!m_data) {
+        if (m_mapping) CloseHandle(m_mapping);
+        CloseHandle(m_file);
+        throw ResourceLoadException("Failed to map config file: " + filename);
+    }
+}
+
+MappedFile::~MappedFile() {
+    if (m_data) UnmapViewOfFile(m_data);
+    if (m_mapping) CloseHandle(m_mapping);
+    if (m_file) CloseHandle(m_file);
+}
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string& filename) {
+    const int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw ResourceLoadException("Failed to open config file: " + filename);
+    }
+    struct stat info{};
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw ResourceLoadException("Failed to read config file: " + filename);
+    }
+    m_size = static_cast<std::size_t>(info.st_size);
+    if (m_size > 0) {
+        void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            ::close(fd);
+            throw ResourceLoadException("Failed to map config file: " + filename);
+        }
+        m_data = static_cast<const char*>(data);
+    }
+    // The mapping keeps the file alive on its own.
+    ::close(fd);
+}
+
+MappedFile::~MappedFile() {
+    if (m_data) {
+        ::munmap(const_cast<char*>(m_data), m_size);
+    }
+}
+#endif
@@ -0,0 +1,216 @@
+#include "ParameterSweep.h"
+#include "BatchSimulation.h"
+#include "GameException.h"
+#include "Random.h"
+#include "Tatepon.h"
+#include "Yaripon.h"
+#include "Yumipon.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <utility>
+
+namespace {
+    const std::vector<std::string> SWEEP_PARAMETERS = {
+        "SHIELD.HP", "SHIELD.ATK", "SHIELD.DEF",
+        "SPEAR.HP", "SPEAR.ATK", "SPEAR.DEF",
+        "BOW.HP", "BOW.ATK", "BOW.DEF",
+        "ENEMY.HP", "ENEMY.ATK",
+        "BOSS.HP", "BOSS.ATK", "BOSS.BONUS"
+    };
+}
+
+SweepRange::SweepRange(std::string parameter, int min, int max, int step)
+    : m_parameter(std::move(parameter)), m_min(min), m_max(max), m_step(step) {
+    if (std::ranges::find(SWEEP_PARAMETERS, m_parameter) == SWEEP_PARAMETERS.end()) {
+        throw InvalidInputException("Unknown sweep parameter: " + m_parameter);
+    }
+    if (min > max || step <= 0) {
+        throw InvalidInputException("Invalid range for sweep parameter " + m_parameter);
+    }
+}
+
+ParameterSweep ParameterSweep::loadFromFile(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        throw ResourceLoadException("Failed to open sweep file: " + filename);
+    }
+
+    ParameterSweep sweep;
+    std::string line;
+
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') continue;
+
+        std::istringstream iss(line);
+        std::string keyword;
+        iss >> keyword;
+
+        if (keyword == "RANGE") {
+            std::string parameter;
+            int min, max, step;
+            if (!(iss >> parameter >> min >> max >> step)) {
+                throw InvalidInputException("Invalid RANGE format in sweep file");
+            }
+            std::ranges::transform(parameter, parameter.begin(), ::toupper);
+            if (std::ranges::any_of(sweep.m_ranges, [&parameter](const SweepRange& range) { return range.getParameter() == parameter; })) {
+                throw InvalidInputException("Duplicate RANGE for parameter " + parameter + " in sweep file");
+            }
+            sweep.m_ranges.emplace_back(parameter, min, max, step);
+        } else if (keyword == "SAMPLING") {
+            std::string mode;
+            iss >> mode;
+            if (mode == "GRID") {
+                sweep.m_latinHypercube = false;
+            } else if (mode == "LHS" && (iss >> sweep.m_samples) && sweep.m_samples > 0) {
+                sweep.m_latinHypercube = true;
+            } else {
+                throw InvalidInputException("Invalid SAMPLING format in sweep file");
+            }
+        } else if (keyword == "SEEDS") {
+            if (!(iss >> sweep.m_seedsPerConfiguration) || sweep.m_seedsPerConfiguration <= 0) {
+                throw InvalidInputException("Invalid SEEDS format in sweep file");
+            }
+        } else if (keyword == "SEED") {
+            if (!(iss >> sweep.m_baseSeed)) {
+                throw InvalidInputException("Invalid SEED format in sweep file");
+            }
+        }
+    }
+
+    return sweep;
+}
+
+std::vector<std::vector<int>> ParameterSweep::sampleConfigurations() const {
+    std::vector<std::vector<int>> configurations;
+
+    if (m_latinHypercube) {
+        configurations.assign(static_cast<std::size_t>(m_samples), std::vector<int>(m_ranges.size()));
+        Random random(m_baseSeed);
+        std::vector<int> strata(static_cast<std::size_t>(m_samples));
+
+        for (std::size_t d = 0; d < m_ranges.size(); ++d) {
+            std::iota(strata.begin(), strata.end(), 0);
+            for (int i = m_samples - 1; i > 0; --i) {
+                std::swap(strata[static_cast<std::size_t>(i)], strata[static_cast<std::size_t>(random.nextBelow(i + 1))]);
+            }
+
+            const SweepRange& range = m_ranges[d];
+            for (std::size_t s = 0; s < configurations.size(); ++s) {
+                double position = (strata[s] + 0.5) / m_samples;
+                double raw = position * (range.getMax() - range.getMin());
+                int index = static_cast<int>(std::lround(raw / range.getStep()));
+                configurations[s][d] = range.getValue(std::clamp(index, 0, range.getValueCount() - 1));
+            }
+        }
+        return configurations;
+    }
+
+    long long total = 1;
+    for (const auto& range : m_ranges) {
+        total *= range.getValueCount();
+        if (total > MAX_GRID_CONFIGURATIONS) {
+            throw InvalidInputException("Sweep grid is too large, use SAMPLING LHS instead");
+        }
+    }
+
+    std::vector<int> indices(m_ranges.size(), 0);
+    configurations.reserve(static_cast<std::size_t>(total));
+    for (long long c = 0; c < total; ++c) {
+        std::vector<int> values(m_ranges.size());
+        for (std::size_t d = 0; d < m_ranges.size(); ++d) {
+            values[d] = m_ranges[d].getValue(indices[d]);
+        }
+        configurations.push_back(std::move(values));
+
+        for (std::size_t d = 0; d < m_ranges.size(); ++d) {
+            if (++indices[d] < m_ranges[d].getValueCount()) break;
+            indices[d] = 0;
+        }
+    }
+    return configurations;
+}
+
+void ParameterSweep::run(const std::vector<std::unique_ptr<Patapon>>& baseSoldiers, const Scenario& baseScenario,
+                         const DrumPolicy& policy, ThreadPool& pool, std::ostream& csv) const {
+    const std::vector<std::vector<int>> configurations = sampleConfigurations();
+    std::vector<BatchStats> results(configurations.size());
+
+    for (std::size_t c = 0; c < configurations.size(); ++c) {
+        pool.submit([this, &baseSoldiers, &baseScenario, &policy, &configurations, &results, c](std::size_t) {
+            const BatchSimulation batch(buildArmy(baseSoldiers, configurations[c]), policy,
+                                        buildScenario(baseScenario, configurations[c]),
+                                        Simulation::maxTurnsFor(baseScenario.getLayout()));
+            results[c] = batch.runRange(0, m_seedsPerConfiguration, m_baseSeed);
+        });
+    }
+    pool.wait();
+
+    csv << "configuration";
+    for (const auto& range : m_ranges) {
+        csv << "," << range.getParameter();
+    }
+    csv << ",games,win_rate,avg_turns,avg_turns_to_win,avg_damage_dealt,avg_damage_taken\n";
+
+    for (std::size_t c = 0; c < configurations.size(); ++c) {
+        csv << c;
+        for (int value : configurations[c]) {
+            csv << "," << value;
+        }
+        const BatchStats& stats = results[c];
+        csv << "," << stats.getGames()
+            << "," << stats.getWinRate()
+            << "," << stats.getAverageTurns()
+            << "," << stats.getAverageTurnsToWin()
+            << "," << stats.getAverageDamageDealt()
+            << "," << stats.getAverageDamageTaken() << "\n";
+    }
+}
+
+template <typename T>
+std::unique_ptr<Patapon> ParameterSweep::sweptSoldier(const Patapon& base, const std::string& key,
+                                                      const std::vector<int>& values) const {
+    return std::make_unique<T>(base.getName(), lookup(key + ".HP", values, base.getMaxHP()),
+                               lookup(key + ".ATK", values, base.getATK()),
+                               lookup(key + ".DEF", values, base.getDEF()));
+}
+
+Army ParameterSweep::buildArmy(const std::vector<std::unique_ptr<Patapon>>& baseSoldiers,
+                               const std::vector<int>& values) const {
+    std::vector<std::unique_ptr<Patapon>> soldiers;
+    soldiers.reserve(baseSoldiers.size());
+
+    for (const auto& s : baseSoldiers) {
+        switch (s->getType()) {
+            case PataponType::SHIELD: soldiers.push_back(sweptSoldier<Tatepon>(*s, "SHIELD", values)); break;
+            case PataponType::SPEAR: soldiers.push_back(sweptSoldier<Yaripon>(*s, "SPEAR", values)); break;
+            case PataponType::BOW: soldiers.push_back(sweptSoldier<Yumipon>(*s, "BOW", values)); break;
+        }
+    }
+
+    return Army(soldiers, 0);
+}
+
+Scenario ParameterSweep::buildScenario(const Scenario& baseScenario, const std::vector<int>& values) const {
+    const Enemy& beast = baseScenario.getBeast();
+    const Boss& boss = baseScenario.getBoss();
+
+    Enemy sweptBeast(beast.getName(), lookup("ENEMY.HP", values, beast.getMaxHP()),
+                     lookup("ENEMY.ATK", values, beast.getATK()), 0);
+    Boss sweptBoss(boss.getName(), lookup("BOSS.HP", values, boss.getMaxHP()),
+                   lookup("BOSS.ATK", values, boss.getATK()), 0,
+                   lookup("BOSS.BONUS", values, boss.getBonusDamage()));
+    Scenario scenario(sweptBeast, sweptBoss, baseScenario.getChants());
+    scenario.setLayout(baseScenario.getLayout());
+    return scenario;
+}
+
+int ParameterSweep::lookup(const std::string& parameter, const std::vector<int>& values, int fallback) const {
+    for (std::size_t d = 0; d < m_ranges.size(); ++d) {
+        if (m_ranges[d].getParameter() == parameter) return values[d];
+    }
+    return fallback;
+}
@@ -0,0 +1,74 @@
+#include "Scenario.h"
+#include "GameException.h"
+#include <string>
+#include <utility>
+
+Scenario::Scenario(std::shared_ptr<const ChantBook> chants)
+    : m_beast(std::make_unique<Enemy>("Bestia", 20, 2, 0)),
+      m_boss(std::make_unique<Boss>("Zigoton General", 50, 2, 0, 3)),
+      m_chants(std::move(chants)) {
+    if (!m_chants) {
+        throw InvalidStateException("Scenario needs a chant book");
+    }
+}
+
+Scenario::Scenario(const Enemy& beast, const Boss& boss, std::shared_ptr<const ChantBook> chants)
+    : m_beast(std::make_unique<Enemy>(beast)),
+      m_boss(std::make_unique<Boss>(boss)),
+      m_chants(std::move(chants)) {
+    if (!m_chants) {
+        throw InvalidStateException("Scenario needs a chant book");
+    }
+}
+
+Scenario::Scenario(const Scenario& other)
+    : m_beast(std::make_unique<Enemy>(*other.m_beast)),
+      m_boss(std::make_unique<Boss>(*other.m_boss)),
+      m_chants(other.m_chants),
+      m_layout(other.m_layout) {}
+
+Scenario& Scenario::operator=(Scenario other) {
+    swap(*this, other);
+    return *this;
+}
+
+void swap(Scenario& first, Scenario& second) noexcept {
+    using std::swap;
+    swap(first.m_beast, second.m_beast);
+    swap(first.m_boss, second.m_boss);
+    swap(first.m_chants, second.m_chants);
+    swap(first.m_layout, second.m_layout);
+}
+
+void Scenario::setLayout(const MapLayout& layout) {
+    if (layout.length < 7) {
+        throw InvalidInputException("Map must be at least 7 tiles long");
+    }
+    if (layout.waves < 1 || layout.waveSpacing < 0) {
+        throw InvalidInputException("Map needs at least one wave and a non-negative wave spacing");
+    }
+    const long long firstSpawn = static_cast<long long>(layout.length) - 6
+                               - static_cast<long long>(layout.waves - 1) * layout.waveSpacing;
+    if (firstSpawn < 1) {
+        throw InvalidInputException("Waves do not fit on a map of " + std::to_string(layout.length) + " tiles");
+    }
+    m_layout = layout;
+}
+
+std::unique_ptr<Enemy> Scenario::makeBeast(int pos) const {
+    return spawn(*m_beast, pos);
+}
+
+std::unique_ptr<Enemy> Scenario::makeBoss(int pos) const {
+    return spawn(*m_boss, pos);
+}
+
+std::unique_ptr<Enemy> Scenario::spawn(const Enemy& prototype, int pos) {
+    auto clonedUnit = prototype.clone();
+    auto enemy = std::unique_ptr<Enemy>(dynamic_cast<Enemy*>(clonedUnit.release()));
+    if (!enemy) {
+        throw InvalidStateException("Scenario prototype is not an enemy");
+    }
+    enemy->setPos(pos);
+    return enemy;
+}
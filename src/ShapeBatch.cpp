@@ -0,0 +1,64 @@
+#include "ShapeBatch.h"
+#include <cmath>
+#include <numbers>
+
+ShapeBatch::ShapeBatch()
+    : m_vertices(sf::PrimitiveType::Triangles) {
+    for (std::size_t i = 0; i < CIRCLE_POINTS; ++i) {
+        float angle = static_cast<float>(i) * 2.0f * std::numbers::pi_v<float> / CIRCLE_POINTS - std::numbers::pi_v<float> / 2.0f;
+        m_unitCircle[i] = {std::cos(angle), std::sin(angle)};
+    }
+}
+
+void ShapeBatch::clear() {
+    m_vertices.clear();
+}
+
+void ShapeBatch::addTriangle(sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Color color) {
+    m_vertices.append(sf::Vertex{a, color});
+    m_vertices.append(sf::Vertex{b, color});
+    m_vertices.append(sf::Vertex{c, color});
+}
+
+void ShapeBatch::addQuad(sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Vector2f d, sf::Color color) {
+    addTriangle(a, b, c, color);
+    addTriangle(a, c, d, color);
+}
+
+void ShapeBatch::addRect(sf::Vector2f position, sf::Vector2f size, sf::Color color) {
+    addQuad(position,
+            {position.x + size.x, position.y},
+            position + size,
+            {position.x, position.y + size.y},
+            color);
+}
+
+void ShapeBatch::addRectOutline(sf::Vector2f position, sf::Vector2f size, float thickness, sf::Color color) {
+    const sf::Vector2f outer = position - sf::Vector2f(thickness, thickness);
+    const float outerWidth = size.x + 2 * thickness;
+    addRect(outer, {outerWidth, thickness}, color);
+    addRect({outer.x, position.y + size.y}, {outerWidth, thickness}, color);
+    addRect({outer.x, position.y}, {thickness, size.y}, color);
+    addRect({position.x + size.x, position.y}, {thickness, size.y}, color);
+}
+
+void ShapeBatch::addCircle(sf::Vector2f center, float radius, sf::Color color) {
+    for (std::size_t i = 0; i < CIRCLE_POINTS; ++i) {
+        const sf::Vector2f& from = m_unitCircle[i];
+        const sf::Vector2f& to = m_unitCircle[(i + 1) % CIRCLE_POINTS];
+        addTriangle(center, center + from * radius, center + to * radius, color);
+    }
+}
+
+void ShapeBatch::addRing(sf::Vector2f center, float innerRadius, float outerRadius, sf::Color color) {
+    for (std::size_t i = 0; i < CIRCLE_POINTS; ++i) {
+        const sf::Vector2f& from = m_unitCircle[i];
+        const sf::Vector2f& to = m_unitCircle[(i + 1) % CIRCLE_POINTS];
+        addQuad(center + from * innerRadius, center + from * outerRadius,
+                center + to * outerRadius, center + to * innerRadius, color);
+    }
+}
+
+void ShapeBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    target.draw(m_vertices, states);
+}
@@ -0,0 +1,54 @@
+#include "Simulation.h"
+#include "GameException.h"
+#include <algorithm>
+#include <limits>
+
+SimulationResult::SimulationResult(bool won, bool lost, const GameStats& stats)
+    : m_won(won), m_lost(lost), m_stats(stats) {}
+
+Simulation::Simulation(int maxTurns)
+    : m_maxTurns(maxTurns) {
+    if (maxTurns <= 0) {
+        throw InvalidInputException("Simulation turn limit must be positive");
+    }
+}
+
+int Simulation::maxTurnsFor(const MapLayout& layout) {
+    const long long segments = (static_cast<long long>(layout.length) + GameConstants::MAP_SIZE - 1) / GameConstants::MAP_SIZE;
+    return static_cast<int>(std::min<long long>(segments * DEFAULT_MAX_TURNS, std::numeric_limits<int>::max()));
+}
+
+SimulationResult Simulation::run(Game& game, DrumPolicy& policy) const {
+    settle(game);
+
+    while (!game.hasWon() && !game.hasLost() && game.getStats().getTurns() < m_maxTurns) {
+        game.submitCommand(policy.nextDrum());
+        settle(game);
+    }
+
+    return {game.hasWon(), game.hasLost(), game.getStats()};
+}
+
+SimulationResult Simulation::replay(Game& game, const std::vector<Drum>& drums) {
+    settle(game);
+
+    for (Drum drum : drums) {
+        if (game.hasWon() || game.hasLost()) break;
+        game.submitCommand(drum);
+        settle(game);
+    }
+
+    return {game.hasWon(), game.hasLost(), game.getStats()};
+}
+
+void Simulation::settle(Game& game) {
+    game.update();
+    if (game.isBossEventActive()) {
+        game.triggerBossSpawn();
+        game.update();
+    }
+    if (game.isVictoryMarching()) {
+        game.finishVictoryMarch();
+    }
+    (void)game.pollAttackTriggered();
+}
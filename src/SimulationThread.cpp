@@ -0,0 +1,148 @@
+#include "SimulationThread.h"
+#include "Boss.h"
+#include "GameException.h"
+#include <algorithm>
+
+SimulationThread::SimulationThread(std::unique_ptr<Game> game, int tickRate)
+    : m_game(std::move(game)) {
+    if (!m_game) {
+        throw InvalidStateException("Simulation thread needs a game");
+    }
+    if (tickRate <= 0) {
+        throw InvalidInputException("Simulation tick rate must be positive");
+    }
+    m_tick = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::seconds(1)) / tickRate;
+    m_tickSeconds = 1.0f / static_cast<float>(tickRate);
+
+    capture(m_snapshots.back());
+    m_snapshots.publish();
+    m_thread = std::thread(&SimulationThread::run, this);
+}
+
+SimulationThread::~SimulationThread() {
+    m_stopping.store(true, std::memory_order_release);
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+bool SimulationThread::submit(Drum drum, std::chrono::steady_clock::time_point pressedAt) noexcept {
+    return m_inputs.push({drum, pressedAt});
+}
+
+bool SimulationThread::poll() {
+    if (!m_snapshots.hasFresh()) return false;
+    m_previous = m_snapshots.front();
+    m_snapshots.update();
+    return true;
+}
+
+float SimulationThread::getInterpolation() const {
+    const auto elapsed = std::chrono::steady_clock::now() - getCurrent().publishedAt;
+    const float alpha = std::chrono::duration<float>(elapsed).count() / m_tickSeconds;
+    return std::clamp(alpha, 0.0f, 1.0f);
+}
+
+void SimulationThread::run() {
+    auto next = std::chrono::steady_clock::now();
+    while (!m_stopping.load(std::memory_order_acquire)) {
+        step();
+        next += m_tick;
+        const auto now = std::chrono::steady_clock::now();
+        if (now - next > m_tick * MAX_CATCH_UP_TICKS) {
+            next = now;
+        }
+        std::this_thread::sleep_until(next);
+    }
+}
+
+void SimulationThread::step() {
+    const std::uint64_t tick = m_tickCount.load(std::memory_order_relaxed) + 1;
+    DrumInput input;
+    while (m_inputs.pop(input)) {
+        const auto drainedAt = std::chrono::steady_clock::now();
+        m_game->submitCommand(input.drum);
+        m_traces.push({input.pressedAt, drainedAt, std::chrono::steady_clock::now(), tick});
+    }
+
+    Game& game = *m_game;
+    if (!game.hasWon() && !game.hasLost()) {
+        if (game.isVictoryMarching()) {
+            m_victoryTimer += m_tickSeconds;
+            if (m_victoryTimer >= VICTORY_MARCH_SECONDS) {
+                game.finishVictoryMarch();
+            }
+        }
+
+        game.update();
+
+        if (game.isBossEventActive()) {
+            m_bossEventTimer += m_tickSeconds;
+            if (m_bossEventTimer >= BOSS_REVEAL_SECONDS) {
+                game.triggerBossSpawn();
+                m_bossEventTimer = 0.0f;
+            }
+        }
+    }
+    if (game.pollAttackTriggered()) {
+        ++m_attacks;
+    }
+
+    capture(m_snapshots.back());
+    m_snapshots.publish();
+}
+
+void SimulationThread::capture(RenderSnapshot& snapshot) {
+    const Game& game = *m_game;
+    const Army& army = game.getArmy();
+
+    snapshot.tick = m_tickCount.fetch_add(1, std::memory_order_relaxed) + 1;
+    snapshot.publishedAt = std::chrono::steady_clock::now();
+
+    snapshot.armyPosition = army.getPosition();
+    snapshot.livingSoldiers = army.getLivingCount();
+    snapshot.maxLivingRange = army.getMaxLivingRange();
+    snapshot.goal = game.getGoal();
+    snapshot.mapSize = game.getMapSize();
+
+    snapshot.soldiers.clear();
+    for (const auto& soldier : army.getSoldiers()) {
+        snapshot.soldiers.push_back({soldier.getHP(), soldier.getMaxHP()});
+    }
+
+    snapshot.enemies.clear();
+    const TileIndex& tiles = game.getTiles();
+    for (int tile = snapshot.armyPosition - SNAPSHOT_RADIUS; tile <= snapshot.armyPosition + SNAPSHOT_RADIUS; ++tile) {
+        if (tiles.count(tile) == 0) continue;
+        std::size_t stack = tiles.countLiving(tile);
+        tiles.forEach(tile, [&snapshot, &stack](const Enemy& e) {
+            if (!e.isAlive()) return;
+            const Boss* boss = e.isBoss() ? dynamic_cast<const Boss*>(&e) : nullptr;
+            snapshot.enemies.push_back({e.getId(), e.getPos(), boss != nullptr,
+                                        boss && boss->isCharging(), boss ? boss->getChargeTurns() : 0, stack});
+            stack = 0;
+        });
+    }
+
+    snapshot.commands.clear();
+    const CommandSequence& commands = game.getCommands();
+    for (std::size_t i = 0; i < commands.size(); ++i) {
+        snapshot.commands.push_back(commands[i]);
+    }
+
+    const EventLog& events = game.getEvents();
+    if (!events.empty() && (!m_describedEvent || *m_describedEvent != events.back())) {
+        m_describedEvent = events.back();
+        m_describedText = ">>> " + game.describe(events.back());
+    }
+    snapshot.lastEvent = m_describedText;
+    snapshot.attacks = m_attacks;
+
+    snapshot.won = game.hasWon();
+    snapshot.lost = game.hasLost();
+    snapshot.bossEventActive = game.isBossEventActive();
+    snapshot.victoryMarching = game.isVictoryMarching();
+    snapshot.bossEventTimer = m_bossEventTimer;
+    snapshot.victoryTimer = m_victoryTimer;
+    snapshot.stats = game.getStats();
+}
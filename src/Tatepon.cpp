@@ -13,6 +13,10 @@ int Tatepon::getRange() const {
     return 1;
 }
 
+PataponType Tatepon::getType() const {
+    return PataponType::SHIELD;
+}
+
 int Tatepon::dealDamage() const {
     return std::max(0, m_atk - 1);
 }
@@ -0,0 +1,58 @@
+#include "TextCache.h"
+
+TextCache::TextCache(const sf::Font& font)
+    : m_font(font) {}
+
+void TextCache::prewarm(std::initializer_list<unsigned> sizes) const {
+    for (unsigned size : sizes) {
+        for (char32_t codePoint = U' '; codePoint <= U'~'; ++codePoint) {
+            (void)m_font.getGlyph(codePoint, size, false);
+        }
+    }
+}
+
+sf::Text& TextCache::update(std::size_t slot, std::string_view content, unsigned size, sf::Color color, TextOrigin origin) {
+    if (slot >= m_entries.size()) {
+        m_entries.resize(slot + 1);
+    }
+
+    Entry& entry = m_entries[slot];
+    if (!entry.text) {
+        entry.text.emplace(m_font, "", size);
+        entry.size = size;
+    }
+
+    sf::Text& text = *entry.text;
+    bool layoutChanged = false;
+    if (entry.content != content) {
+        entry.content.assign(content);
+        text.setString(entry.content);
+        layoutChanged = true;
+    }
+    if (entry.size != size) {
+        entry.size = size;
+        text.setCharacterSize(size);
+        layoutChanged = true;
+    }
+    if (text.getFillColor() != color) {
+        text.setFillColor(color);
+    }
+
+    if (layoutChanged || entry.origin != origin) {
+        entry.origin = origin;
+        const sf::FloatRect bounds = text.getLocalBounds();
+        switch (origin) {
+            case TextOrigin::TOP_LEFT:
+                text.setOrigin({0, 0});
+                break;
+            case TextOrigin::CENTER:
+                text.setOrigin({bounds.size.x / 2, bounds.size.y / 2});
+                break;
+            case TextOrigin::LABEL:
+                text.setOrigin({bounds.size.x / 2, bounds.size.y / 2 + 5});
+                break;
+        }
+        ++m_rebuildCount;
+    }
+    return text;
+}
@@ -0,0 +1,99 @@
+#include "ThreadPool.h"
+#include <algorithm>
+#include <utility>
+
+void ThreadPool::WorkQueue::push(Task task) {
+    std::lock_guard lock(m_mutex);
+    m_tasks.push_back(std::move(task));
+}
+
+bool ThreadPool::WorkQueue::popBack(Task& task) {
+    std::lock_guard lock(m_mutex);
+    if (m_tasks.empty()) return false;
+    task = std::move(m_tasks.back());
+    m_tasks.pop_back();
+    return true;
+}
+
+bool ThreadPool::WorkQueue::stealFront(Task& task) {
+    std::lock_guard lock(m_mutex);
+    if (m_tasks.empty()) return false;
+    task = std::move(m_tasks.front());
+    m_tasks.pop_front();
+    return true;
+}
+
+ThreadPool::ThreadPool(std::size_t threads) {
+    threads = std::max<std::size_t>(1, threads);
+    m_queues.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+        m_queues.push_back(std::make_unique<WorkQueue>());
+    }
+    m_threads.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+        m_threads.emplace_back([this, i] { workerLoop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    m_stopping.store(true, std::memory_order_release);
+    m_available.release(static_cast<std::ptrdiff_t>(m_threads.size()));
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void ThreadPool::submit(Task task) {
+    m_pending.fetch_add(1, std::memory_order_relaxed);
+    m_queues[m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size()]->push(std::move(task));
+    m_available.release();
+}
+
+void ThreadPool::wait() {
+    for (std::size_t pending = m_pending.load(std::memory_order_acquire); pending != 0;
+         pending = m_pending.load(std::memory_order_acquire)) {
+        m_pending.wait(pending, std::memory_order_acquire);
+    }
+    std::lock_guard lock(m_errorMutex);
+    if (m_error) {
+        std::exception_ptr error = std::exchange(m_error, nullptr);
+        std::rethrow_exception(error);
+    }
+}
+
+// Every token matches a task that is already queued, or a shutdown. A scan
+// can still come up empty while another worker holding its own token races
+// it to the same queue; the task this token stands for is then elsewhere, so
+// the worker scans again.
+void ThreadPool::workerLoop(std::size_t index) {
+    Task task;
+    while (true) {
+        m_available.acquire();
+        while (!tryTake(index, task)) {
+            if (m_stopping.load(std::memory_order_acquire)) return;
+            std::this_thread::yield();
+        }
+        finish(index, task);
+    }
+}
+
+bool ThreadPool::tryTake(std::size_t index, Task& task) {
+    bool found = m_queues[index]->popBack(task);
+    for (std::size_t k = 1; !found && k < m_queues.size(); ++k) {
+        found = m_queues[(index + k) % m_queues.size()]->stealFront(task);
+    }
+    return found;
+}
+
+void ThreadPool::finish(std::size_t index, Task& task) {
+    try {
+        task(index);
+    } catch (...) {
+        std::lock_guard lock(m_errorMutex);
+        if (!m_error) m_error = std::current_exception();
+    }
+    task = nullptr;
+    if (m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        m_pending.notify_all();
+    }
+}
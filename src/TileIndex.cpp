@@ -0,0 +1,110 @@
+#include "TileIndex.h"
+#include "Enemy.h"
+#include "GameException.h"
+#include <string>
+
+TileIndex::TileIndex(int tiles)
+    : m_tileCount(tiles) {
+    if (tiles <= 0) {
+        throw InvalidInputException("Tile index needs at least one tile");
+    }
+}
+
+void TileIndex::insert(Enemy& enemy) {
+    const EntityId id = enemy.getId();
+    if (!id.isValid()) {
+        throw InvalidStateException("Enemy must have an id before it is indexed");
+    }
+    if (!contains(enemy.getPos())) {
+        throw InvalidInputException("Enemy position outside the map: " + std::to_string(enemy.getPos()));
+    }
+    if (id.index >= m_links.size()) {
+        m_links.resize(static_cast<std::size_t>(id.index) + 1);
+    }
+    if (m_links[id.index].enemy) {
+        throw InvalidStateException("Enemy is already indexed");
+    }
+    m_links[id.index].enemy = &enemy;
+    link(id.index, enemy.getPos());
+    enemy.setTileIndex(this);
+}
+
+void TileIndex::remove(Enemy& enemy) {
+    const std::uint32_t index = linkIndex(enemy);
+    unlink(index, enemy.getPos());
+    m_links[index].enemy = nullptr;
+    enemy.setTileIndex(nullptr);
+}
+
+void TileIndex::move(const Enemy& enemy, int from, int to) {
+    if (from == to) return;
+    if (!contains(to)) {
+        throw InvalidInputException("Enemy position outside the map: " + std::to_string(to));
+    }
+    const std::uint32_t index = linkIndex(enemy);
+    unlink(index, from);
+    link(index, to);
+}
+
+Enemy* TileIndex::firstLiving(int tile) const {
+    const Bucket* bucket = find(tile);
+    if (!bucket) return nullptr;
+    for (std::uint32_t i = bucket->head; i != NONE; i = m_links[i].next) {
+        if (m_links[i].enemy->isAlive()) return m_links[i].enemy;
+    }
+    return nullptr;
+}
+
+std::size_t TileIndex::countLiving(int tile) const {
+    std::size_t living = 0;
+    forEach(tile, [&living](const Enemy& enemy) {
+        if (enemy.isAlive()) ++living;
+    });
+    return living;
+}
+
+void TileIndex::link(std::uint32_t index, int tile) {
+    Bucket& bucket = m_buckets[tile];
+    Link& entry = m_links[index];
+    entry.prev = bucket.tail;
+    entry.next = NONE;
+    if (bucket.tail != NONE) {
+        m_links[bucket.tail].next = index;
+    } else {
+        bucket.head = index;
+    }
+    bucket.tail = index;
+    ++bucket.count;
+}
+
+void TileIndex::unlink(std::uint32_t index, int tile) {
+    const auto it = m_buckets.find(tile);
+    if (it == m_buckets.end()) {
+        throw InvalidStateException("Enemy is not on tile " + std::to_string(tile));
+    }
+    Bucket& bucket = it->second;
+    Link& entry = m_links[index];
+    if (entry.prev != NONE) {
+        m_links[entry.prev].next = entry.next;
+    } else {
+        bucket.head = entry.next;
+    }
+    if (entry.next != NONE) {
+        m_links[entry.next].prev = entry.prev;
+    } else {
+        bucket.tail = entry.prev;
+    }
+    entry.prev = NONE;
+    entry.next = NONE;
+    if (--bucket.count == 0) {
+        m_buckets.erase(it);
+    }
+}
+
+std::uint32_t TileIndex::linkIndex(const Enemy& enemy) const {
+    const std::uint32_t index = enemy.getId().index;
+    if (index >= m_links.size() || m_links[index].enemy != &enemy) {
+        throw InvalidStateException("Enemy is not in the tile index");
+    }
+    return index;
+}
@@ -0,0 +1,58 @@
+#include "VoicePool.h"
+#include "GameException.h"
+#include <algorithm>
+
+VoicePool::VoicePool(const sf::SoundBuffer& buffer, std::size_t voices) {
+    if (voices == 0) {
+        throw InvalidInputException("Voice pool needs at least one voice");
+    }
+    m_voices.reserve(voices);
+    for (std::size_t i = 0; i < voices; ++i) {
+        m_voices.emplace_back(buffer);
+    }
+}
+
+void VoicePool::play(Clock::time_point pressedAt) {
+    Voice* voice = nullptr;
+    for (std::size_t k = 0; k < m_voices.size() && !voice; ++k) {
+        Voice& candidate = m_voices[(m_next + k) % m_voices.size()];
+        if (candidate.sound.getStatus() == sf::Sound::Status::Stopped) {
+            voice = &candidate;
+        }
+    }
+    if (!voice) {
+        voice = &*std::ranges::min_element(m_voices, {}, &Voice::started);
+        ++m_steals;
+    }
+    m_next = static_cast<std::size_t>(voice - m_voices.data() + 1) % m_voices.size();
+
+    voice->sound.stop();
+    voice->sound.play();
+    voice->started = ++m_plays;
+    voice->pressedAt = pressedAt;
+    voice->awaitingSound = true;
+}
+
+void VoicePool::update() {
+    const Clock::time_point now = Clock::now();
+    for (Voice& voice : m_voices) {
+        if (!voice.awaitingSound) continue;
+
+        const sf::Time offset = voice.sound.getPlayingOffset();
+        if (offset > sf::Time::Zero) {
+            const Clock::time_point audible = now - std::chrono::microseconds(offset.asMicroseconds());
+            const auto latency = std::max(std::chrono::microseconds{0},
+                                          std::chrono::duration_cast<std::chrono::microseconds>(audible - voice.pressedAt));
+            m_totalLatency += latency;
+            m_worstLatency = std::max(m_worstLatency, latency);
+            ++m_measured;
+            voice.awaitingSound = false;
+        } else if (voice.sound.getStatus() == sf::Sound::Status::Stopped) {
+            voice.awaitingSound = false;
+        }
+    }
+}
+
+std::chrono::microseconds VoicePool::getMeanLatency() const {
+    return m_measured == 0 ? std::chrono::microseconds{0} : m_totalLatency / static_cast<std::int64_t>(m_measured);
+}
@@ -12,4 +12,8 @@ int Yaripon::getRange() const {
     return 2;
 }
 
+PataponType Yaripon::getType() const {
+    return PataponType::SPEAR;
+}
+
 
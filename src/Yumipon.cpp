@@ -12,6 +12,10 @@ int Yumipon::getRange() const {
     return 3;
 }
 
+PataponType Yumipon::getType() const {
+    return PataponType::BOW;
+}
+
 int Yumipon::dealDamage() const {
     return m_atk + 2;
 }
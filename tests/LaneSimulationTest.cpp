@@ -0,0 +1,87 @@
+#include "Army.h"
+#include "DrumPolicy.h"
+#include "Game.h"
+#include "GameConfig.h"
+#include "KeyScript.h"
+#include "LaneSimulation.h"
+#include "Simulation.h"
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Plays the same seeds through the scalar Game and through LaneSimulation and
+// fails on the first games whose outcome or stats differ.
+namespace {
+    constexpr long long GAMES = 5000;
+    constexpr std::uint64_t BASE_SEED = 1;
+
+    bool sameResult(const SimulationResult& actual, const SimulationResult& expected) {
+        const GameStats& a = actual.getStats();
+        const GameStats& e = expected.getStats();
+        return actual.hasWon() == expected.hasWon() && actual.hasLost() == expected.hasLost()
+            && a.getDamageDealt() == e.getDamageDealt() && a.getDamageTaken() == e.getDamageTaken()
+            && a.getCommandsCount() == e.getCommandsCount() && a.getStepsTaken() == e.getStepsTaken()
+            && a.getTurns() == e.getTurns() && a.getSeed() == e.getSeed();
+    }
+
+    template <int LANES>
+    long long countMismatches(const std::string& name, const Army& army, const DrumPolicy& policy,
+                              const Scenario& scenario) {
+        const int maxTurns = Simulation::maxTurnsFor(scenario.getLayout());
+        const LaneSimulation<LANES> lanes(army, policy, scenario, maxTurns);
+        const Simulation simulation(maxTurns);
+        const auto scalarPolicy = policy.clone();
+        const std::vector<SimulationResult> results = lanes.runGames(BASE_SEED, GAMES);
+
+        long long mismatches = 0;
+        for (long long i = 0; i < GAMES; ++i) {
+            const std::uint64_t seed = BASE_SEED + static_cast<std::uint64_t>(i);
+            Game game(army, {}, seed, scenario);
+            scalarPolicy->reset(seed);
+            SimulationResult expected = simulation.run(game, *scalarPolicy);
+            GameStats stats = expected.getStats();
+            stats.setSeed(seed);
+            expected = SimulationResult(expected.hasWon(), expected.hasLost(), stats);
+
+            const SimulationResult& actual = results[static_cast<std::size_t>(i)];
+            if (!sameResult(actual, expected)) {
+                if (mismatches < 5) {
+                    std::cout << name << ", " << LANES << " lanes, seed " << seed
+                              << "\n  scalar: " << expected.getStats() << "\n  lanes:  " << actual.getStats() << "\n";
+                }
+                ++mismatches;
+            }
+        }
+        return mismatches;
+    }
+
+    long long checkScenario(const std::string& name, const Army& army, const DrumPolicy& policy,
+                            const Scenario& scenario) {
+        return countMismatches<8>(name, army, policy, scenario) + countMismatches<16>(name, army, policy, scenario);
+    }
+}
+
+int main() {
+    try {
+        const auto config = GameConfig::load("assets/game_config.txt");
+        const Army army(config->getSoldiers(), 0);
+        const Scenario& scenario = config->getScenario();
+
+        Scenario longMap(scenario);
+        longMap.setLayout({60, 5, 8});
+
+        const RandomChantPolicy random(scenario.getChants());
+        const ScriptedPolicy scripted(KeyScript::loadFromFile("tastatura.txt").getDrums());
+
+        const long long mismatches = checkScenario("random", army, random, scenario)
+                                   + checkScenario("script", army, scripted, scenario)
+                                   + checkScenario("random, long map", army, random, longMap);
+        std::cout << "Mismatches: " << mismatches << std::endl;
+        return mismatches == 0 ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}